@@ -10,9 +10,11 @@
 #import "DDCliUtil.h"
 #import "DDGetoptLongParser.h"
 #import "GBStore.h"
+#import "GBDataObjects.h"
 #import "GBParser.h"
 #import "GBProcessor.h"
 #import "GBGenerator.h"
+#import "GBProfiler.h"
 #import "GBApplicationSettingsProvider.h"
 #import "GBAppledocApplication.h"
 
@@ -40,6 +42,11 @@ static NSString *kGBArgFindUndocumentedMembersDocumentation = @"search-undocumen
 static NSString *kGBArgMergeCategoriesToClasses = @"merge-categories";
 static NSString *kGBArgKeepMergedCategoriesSections = @"keep-merged-sections";
 static NSString *kGBArgPrefixMergedCategoriesSectionsWithCategoryName = @"prefix-merged-sections";
+static NSString *kGBArgThreads = @"threads";
+static NSString *kGBArgCacheParsedFiles = @"cache-parsed-files";
+static NSString *kGBArgIncrementalHTML = @"incremental-html";
+static NSString *kGBArgUseParseKitTokenizer = @"use-parsekit";
+static NSString *kGBArgProfileReport = @"profile-report";
 
 static NSString *kGBArgWarnOnMissingOutputPath = @"warn-missing-output-path";
 static NSString *kGBArgWarnOnMissingCompanyIdentifier = @"warn-missing-company-id";
@@ -80,6 +87,8 @@ static NSString *kGBArgHelp = @"help";
 @interface GBAppledocApplication ()
 
 - (void)initializeLoggingSystem;
+- (void)writeProfileReport;
+- (void)reportMemoryUsedByStore:(GBStore *)store sinceResidentSize:(unsigned long long)size;
 - (void)initializeGlobalSettingsAndValidateTemplates;
 - (void)validateSettingsAndArguments:(NSArray *)arguments;
 - (void)overrideSettingsWithGlobalSettingsFromPath:(NSString *)path;
@@ -145,27 +154,36 @@ static NSString *kGBArgHelp = @"help";
 		[self initializeLoggingSystem];
 		
 		GBLogNormal(@"Initializing...");
+		if (self.settings.profileReportPath) [GBProfiler setEnabled:YES];
 		GBStore *store = [[GBStore alloc] init];		
 		GBAbsoluteTime startTime = GetCurrentTime();
+		unsigned long long startSize = GBProfilerResidentSize();
+		GBProfileBegin(parseSample);
 		
 		GBLogNormal(@"Parsing source files...");
 		GBParser *parser = [GBParser parserWithSettingsProvider:self.settings];
 		[parser parseObjectsFromPaths:arguments toStore:store];
 		GBAbsoluteTime parseTime = GetCurrentTime();
+		GBProfileEnd(parseSample, @"parsing");
 		NSUInteger timeForParsing = SubtractTime(parseTime, startTime) * 1000.0;
 		GBLogInfo(@"Finished parsing in %ldms.\n", timeForParsing);
+		[self reportMemoryUsedByStore:store sinceResidentSize:startSize];
 		
 		GBLogNormal(@"Processing parsed data...");
+		GBProfileBegin(processSample);
 		GBProcessor *processor = [GBProcessor processorWithSettingsProvider:self.settings];
 		[processor processObjectsFromStore:store];
 		GBAbsoluteTime processTime = GetCurrentTime();
+		GBProfileEnd(processSample, @"processing");
 		NSUInteger timeForProcessing = SubtractTime(processTime, parseTime) * 1000.0;
 		GBLogInfo(@"Finished processing in %ldms.\n", timeForProcessing);
 		
 		GBLogNormal(@"Generating output...");
+		GBProfileBegin(generateSample);
 		GBGenerator *generator = [GBGenerator generatorWithSettingsProvider:self.settings];
 		[generator generateOutputFromStore:store];
 		GBAbsoluteTime generateTime = GetCurrentTime();
+		GBProfileEnd(generateSample, @"generating");
 		NSUInteger timeForGeneration = SubtractTime(generateTime, processTime) * 1000.0;
 		GBLogInfo(@"Finished generating in %ldms.\n", timeForGeneration);
 		
@@ -174,6 +192,7 @@ static NSString *kGBArgHelp = @"help";
 		GBLogInfo(@"Parsing:    %ldms (%ld%%)", timeForParsing, timeForParsing * 100 / timeForEverything);
 		GBLogInfo(@"Processing: %ldms (%ld%%)", timeForProcessing, timeForProcessing * 100 / timeForEverything);
 		GBLogInfo(@"Generating: %ldms (%ld%%)", timeForGeneration, timeForGeneration * 100 / timeForEverything);
+		[self writeProfileReport];
 	}
 	@catch (NSException *e) {
 		GBLogException(e, @"Oops, something went wrong...");
@@ -240,6 +259,14 @@ static NSString *kGBArgHelp = @"help";
 		{ GBNoArg(kGBArgMergeCategoriesToClasses),							0,		DDGetoptNoArgument },
 		{ GBNoArg(kGBArgKeepMergedCategoriesSections),						0,		DDGetoptNoArgument },
 		{ GBNoArg(kGBArgPrefixMergedCategoriesSectionsWithCategoryName),	0,		DDGetoptNoArgument },
+		{ kGBArgThreads,													0,		DDGetoptRequiredArgument },
+		{ kGBArgCacheParsedFiles,											0,		DDGetoptNoArgument },
+		{ GBNoArg(kGBArgCacheParsedFiles),									0,		DDGetoptNoArgument },
+		{ kGBArgIncrementalHTML,											0,		DDGetoptNoArgument },
+		{ GBNoArg(kGBArgIncrementalHTML),									0,		DDGetoptNoArgument },
+		{ kGBArgUseParseKitTokenizer,										0,		DDGetoptNoArgument },
+		{ GBNoArg(kGBArgUseParseKitTokenizer),								0,		DDGetoptNoArgument },
+		{ kGBArgProfileReport,												0,		DDGetoptRequiredArgument },
 		
 		{ kGBArgWarnOnMissingOutputPath,									0,		DDGetoptNoArgument },
 		{ kGBArgWarnOnMissingCompanyIdentifier,								0,		DDGetoptNoArgument },
@@ -275,6 +302,31 @@ static NSString *kGBArgHelp = @"help";
 	[formatter release];
 }
 
+- (void)writeProfileReport {
+	if (!self.settings.profileReportPath) return;
+	GBLogNormal(@"Writting profiling report to '%@'...", self.settings.profileReportPath);
+	NSError *error = nil;
+	if (![[GBProfiler sharedProfiler] writeReportToFile:self.settings.profileReportPath error:&error]) {
+		GBLogNSError(error, @"Failed writting profiling report to '%@'!", self.settings.profileReportPath);
+	}
+}
+
+- (void)reportMemoryUsedByStore:(GBStore *)store sinceResidentSize:(unsigned long long)size {
+	// Resident size also includes memory used by the parser, so this is only an upper bound of the memory used by the model itself. Still it's good enough to compare the cost of the model between runs.
+	NSUInteger members = 0;
+	NSMutableSet *objects = [NSMutableSet setWithSet:store.classes];
+	[objects unionSet:store.categories];
+	[objects unionSet:store.protocols];
+	for (id<GBObjectDataProviding> object in objects) members += 1 + [object.methods.methods count];
+	if (members == 0) return;
+	
+	unsigned long long currentSize = GBProfilerResidentSize();
+	unsigned long long usedSize = (currentSize > size) ? currentSize - size : 0;
+	GBLogInfo(@"Parsed %lu objects and members using %llu bytes per member.\n", members, usedSize / members);
+	GBProfileCount(@"parsedMembers", members);
+	GBProfileCount(@"bytesPerParsedMember", (NSUInteger)(usedSize / members));
+}
+
 - (void)initializeGlobalSettingsAndValidateTemplates {
 	// This is where we override factory defaults (factory defaults with global templates. This needs to be sent before giving DDCli a chance to go through parameters! DDCli will "take care" (or more correct: it's KVC messages will) of overriding with command line arguments. Note that we scan the arguments backwards to get the latest template value - this is what we'll get with DDCli later on anyway. If no template path is given, check predefined paths.
 	NSArray *arguments = [[NSProcessInfo processInfo] arguments];
@@ -470,6 +522,14 @@ static NSString *kGBArgHelp = @"help";
 - (void)setNoMergeCategories:(BOOL)value { self.settings.mergeCategoriesToClasses = !value; }
 - (void)setNoKeepMergedSections:(BOOL)value { self.settings.keepMergedCategoriesSections = !value; }
 - (void)setNoPrefixMergedSections:(BOOL)value { self.settings.prefixMergedCategoriesSectionsWithCategoryName = !value; }
+- (void)setThreads:(NSString *)value { NSInteger threads = [value integerValue]; self.settings.numberOfThreads = (threads < 0) ? 1 : threads; }
+- (void)setCacheParsedFiles:(BOOL)value { self.settings.cacheParsedFiles = value; }
+- (void)setNoCacheParsedFiles:(BOOL)value { self.settings.cacheParsedFiles = !value; }
+- (void)setIncrementalHtml:(BOOL)value { self.settings.incrementalHTML = value; }
+- (void)setNoIncrementalHtml:(BOOL)value { self.settings.incrementalHTML = !value; }
+- (void)setUseParsekit:(BOOL)value { self.settings.useParseKitTokenizer = value; }
+- (void)setNoUseParsekit:(BOOL)value { self.settings.useParseKitTokenizer = !value; }
+- (void)setProfileReport:(NSString *)path { self.settings.profileReportPath = [self standardizeCurrentDirectoryForPath:path]; }
 
 - (void)setWarnMissingOutputPath:(BOOL)value { self.settings.warnOnMissingOutputPathArgument = value; }
 - (void)setWarnMissingCompanyId:(BOOL)value { self.settings.warnOnMissingCompanyIdentifier = value; }
@@ -572,6 +632,11 @@ static NSString *kGBArgHelp = @"help";
 	ddprintf(@"--%@ = %@\n", kGBArgMergeCategoriesToClasses, PRINT_BOOL(self.settings.mergeCategoriesToClasses));
 	ddprintf(@"--%@ = %@\n", kGBArgKeepMergedCategoriesSections, PRINT_BOOL(self.settings.keepMergedCategoriesSections));
 	ddprintf(@"--%@ = %@\n", kGBArgPrefixMergedCategoriesSectionsWithCategoryName, PRINT_BOOL(self.settings.prefixMergedCategoriesSectionsWithCategoryName));
+	ddprintf(@"--%@ = %lu\n", kGBArgThreads, self.settings.numberOfThreads);
+	ddprintf(@"--%@ = %@\n", kGBArgCacheParsedFiles, PRINT_BOOL(self.settings.cacheParsedFiles));
+	ddprintf(@"--%@ = %@\n", kGBArgIncrementalHTML, PRINT_BOOL(self.settings.incrementalHTML));
+	ddprintf(@"--%@ = %@\n", kGBArgUseParseKitTokenizer, PRINT_BOOL(self.settings.useParseKitTokenizer));
+	ddprintf(@"--%@ = %@\n", kGBArgProfileReport, self.settings.profileReportPath);
 	ddprintf(@"\n");
 	
 	ddprintf(@"--%@ = %@\n", kGBArgWarnOnMissingOutputPath, PRINT_BOOL(self.settings.warnOnMissingOutputPathArgument));
@@ -625,6 +690,11 @@ static NSString *kGBArgHelp = @"help";
 	PRINT_USAGE(@"   ", kGBArgMergeCategoriesToClasses, @"", @"[b] Merge categories to classes");
 	PRINT_USAGE(@"   ", kGBArgKeepMergedCategoriesSections, @"", @"[b] Keep merged categories sections");
 	PRINT_USAGE(@"   ", kGBArgPrefixMergedCategoriesSectionsWithCategoryName, @"", @"[b] Prefix merged sections with category name");
+	PRINT_USAGE(@"   ", kGBArgThreads, @"<number>", @"Number of worker threads, 0 for automatic");
+	PRINT_USAGE(@"   ", kGBArgCacheParsedFiles, @"", @"[b] Cache parsed files data in output path");
+	PRINT_USAGE(@"   ", kGBArgIncrementalHTML, @"", @"[b] Only regenerate changed HTML pages");
+	PRINT_USAGE(@"   ", kGBArgUseParseKitTokenizer, @"", @"[b] Tokenize source files with ParseKit");
+	PRINT_USAGE(@"   ", kGBArgProfileReport, @"<path>", @"Write JSON profiling report to given path");
 	ddprintf(@"\n");
 	ddprintf(@"WARNINGS\n");
 	PRINT_USAGE(@"   ", kGBArgWarnOnMissingOutputPath, @"", @"[b] Warn if output path is not given");
@@ -268,6 +268,36 @@
  */
 @property (assign) BOOL prefixMergedCategoriesSectionsWithCategoryName;
 
+/** The number of threads used for parallelizable phases such as source files parsing, comments processing and HTML pages generation.
+ 
+ If `1`, all work is done serially on the main thread. Any larger value enables concurrent handling with at most the given number of workers. If `0`, the number of workers is determined from the number of active processors. Regardless of the value, generated output is the same as with serial handling. Defaults to `1`.
+ */
+@property (assign) NSUInteger numberOfThreads;
+
+/** Specifies whether parsed source files data should be cached between runs.
+ 
+ If `YES`, objects parsed from each source file are stored to a cache file within `outputPath`, keyed by file path, contents hash and appledoc version. On subsequent runs, files whose contents didn't change are not parsed again, their objects are loaded from the cache instead. If `NO`, all files are always parsed and no cache file is used.
+ */
+@property (assign) BOOL cacheParsedFiles;
+
+/** Specifies whether HTML output should be updated incrementally.
+ 
+ If `YES`, HTML output directory is not removed before generating. Instead a manifest file is kept within `outputPath`, recording the digest of template variables used for each generated page. Pages whose digest didn't change since previous run are neither rendered nor written again and only pages of objects that are no longer present are removed. If `NO`, the whole HTML output is removed and regenerated on each run.
+ */
+@property (assign) BOOL incrementalHTML;
+
+/** Specifies whether source files should be tokenized with ParseKit's `PKTokenizer` instead of native `GBLexer`.
+ 
+ If `NO`, source files are split into tokens by `GBLexer`, which scans UTF-8 bytes and only creates token objects for tokens the parser actually inspects. If `YES`, ParseKit tokenizer is used as in previous versions; this is mainly useful for verifying both produce the same results. Defaults to `NO`.
+ */
+@property (assign) BOOL useParseKitTokenizer;
+
+/** The path to the profiling report file or `nil` if profiling is disabled.
+ 
+ If set, appledoc measures time spent in hot code paths such as reading and tokenizing source files, processing comments, resolving cross references, rendering templates and writting files and writes a JSON report with per-phase wall and CPU times, counters, the slowest files and objects and peak resident memory size to the given path when finished. See `GBProfiler` for details. Defaults to `nil`.
+ */
+@property (copy) NSString *profileReportPath;
+
 ///---------------------------------------------------------------------------------------
 /// @name Warnings handling
 ///---------------------------------------------------------------------------------------
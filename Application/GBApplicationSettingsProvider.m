@@ -65,6 +65,11 @@
 		self.mergeCategoriesToClasses = YES;
 		self.keepMergedCategoriesSections = NO;
 		self.prefixMergedCategoriesSectionsWithCategoryName = NO;
+		self.numberOfThreads = 1;
+		self.cacheParsedFiles = NO;
+		self.incrementalHTML = NO;
+		self.useParseKitTokenizer = NO;
+		self.profileReportPath = nil;
 
 		self.warnOnMissingOutputPathArgument = YES;
 		self.warnOnMissingCompanyIdentifier = YES;
@@ -204,27 +209,38 @@
 #pragma mark Date and time helpers
 
 - (NSString *)yearStringFromDate:(NSDate *)date {
-	return [self.yearDateFormatter stringFromDate:date];
+	// Date formatters are shared and not thread safe, but placeholders may be replaced from concurrent output generation workers.
+	NSDateFormatter *formatter = self.yearDateFormatter;
+	@synchronized(formatter) {
+		return [formatter stringFromDate:date];
+	}
 }
 
 - (NSString *)yearToDayStringFromDate:(NSDate *)date {
-	return [self.yearToDayDateFormatter stringFromDate:date];
+	NSDateFormatter *formatter = self.yearToDayDateFormatter;
+	@synchronized(formatter) {
+		return [formatter stringFromDate:date];
+	}
 }
 
 - (NSDateFormatter *)yearDateFormatter {
 	static NSDateFormatter *result = nil;
-	if (!result) {
-		result = [[NSDateFormatter alloc] init];
-		[result setDateFormat:@"yyyy"];
+	@synchronized([NSDateFormatter class]) {
+		if (!result) {
+			result = [[NSDateFormatter alloc] init];
+			[result setDateFormat:@"yyyy"];
+		}
 	}
 	return result;
 }
 
 - (NSDateFormatter *)yearToDayDateFormatter {
 	static NSDateFormatter *result = nil;
-	if (!result) {
-		result = [[NSDateFormatter alloc] init];
-		[result setDateFormat:@"yyyy-MM-dd"];
+	@synchronized([NSDateFormatter class]) {
+		if (!result) {
+			result = [[NSDateFormatter alloc] init];
+			[result setDateFormat:@"yyyy-MM-dd"];
+		}
 	}
 	return result;
 }
@@ -356,6 +372,11 @@
 @synthesize mergeCategoriesToClasses;
 @synthesize keepMergedCategoriesSections;
 @synthesize prefixMergedCategoriesSectionsWithCategoryName;
+@synthesize numberOfThreads;
+@synthesize cacheParsedFiles;
+@synthesize incrementalHTML;
+@synthesize useParseKitTokenizer;
+@synthesize profileReportPath;
 
 @synthesize createHTML;
 @synthesize createDocSet;
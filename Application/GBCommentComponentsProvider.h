@@ -11,6 +11,8 @@
 /** Provides comment keywords and helpers for the rest of the application.
  
  The main responsibility of the class is to determine if a string contains special section definition. In addition, they also return section parameters. This encapsulates keywords and sections handling and simplifies the rest of the application.
+ 
+ Note that `GBCommentsProcessor` detects lists, sections and method directives with `GBCommentLineScanner`, which recognizes the same syntax as the corresponding regular expressions, so changing these doesn't affect comments processing. Similarly, cross references are detected with `GBCrossReferenceMatcher`, which recognizes the same syntax as cross references regular expressions.
  */
 @interface GBCommentComponentsProvider : NSObject
 
@@ -0,0 +1,65 @@
+//
+//  GBLineIndex.h
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/** Provides fast conversion of string offsets to line numbers.
+ 
+ The index scans the given string once and remembers the offsets of all newline characters. Line number for any offset is then determined by binary search, instead of counting lines from the start of the string each time. This makes it useful whenever many line numbers are needed for the same string, for example when creating source information for all declarations in a source file:
+ 
+	GBLineIndex *index = [GBLineIndex indexWithString:input];
+	NSUInteger line = [index lineNumberAtOffset:[token offset]];
+ 
+ Line numbers are determined the same way as `[NSString numberOfLinesInRange:]` does - each character from `[NSCharacterSet newlineCharacterSet]` starts a new line, so sending `lineNumberAtOffset:` returns the same value as sending `numberOfLinesInRange:` with range from string start to the given offset.
+ */
+@interface GBLineIndex : NSObject {
+	@private
+	NSString *_string;
+	NSData *_newlineOffsets;
+	NSUInteger _numberOfNewlines;
+}
+
+///---------------------------------------------------------------------------------------
+/// @name Initialization & disposal
+///---------------------------------------------------------------------------------------
+
+/** Returns autoreleased index of the given string.
+ 
+ @param string The string to index.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given string is `nil`.
+ */
++ (id)indexWithString:(NSString *)string;
+
+/** Initializes the index of the given string.
+ 
+ This is the designated initializer.
+ 
+ @param string The string to index.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given string is `nil`.
+ */
+- (id)initWithString:(NSString *)string;
+
+///---------------------------------------------------------------------------------------
+/// @name Line numbers handling
+///---------------------------------------------------------------------------------------
+
+/** Returns the line number of the given offset.
+ 
+ Line numbers are 1 based. Offset equal to string length is valid and returns the number of the last line.
+ 
+ @param offset The offset within the string.
+ @return Returns the line number containing the given offset or `NSNotFound` if offset is `NSNotFound` or larger than string length.
+ */
+- (NSUInteger)lineNumberAtOffset:(NSUInteger)offset;
+
+/** The indexed string. */
+@property (readonly) NSString *string;
+
+@end
@@ -0,0 +1,80 @@
+//
+//  GBLineIndex.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBLineIndex.h"
+
+@interface GBLineIndex ()
+
+- (NSData *)newlineOffsetsOfString:(NSString *)string;
+
+@end
+
+#pragma mark -
+
+@implementation GBLineIndex
+
+#pragma mark Initialization & disposal
+
++ (id)indexWithString:(NSString *)string {
+	return [[[self alloc] initWithString:string] autorelease];
+}
+
+- (id)initWithString:(NSString *)string {
+	NSParameterAssert(string != nil);
+	self = [super init];
+	if (self) {
+		_string = [string copy];
+		_newlineOffsets = [[self newlineOffsetsOfString:_string] retain];
+		_numberOfNewlines = [_newlineOffsets length] / sizeof(NSUInteger);
+	}
+	return self;
+}
+
+#pragma mark Line numbers handling
+
+- (NSUInteger)lineNumberAtOffset:(NSUInteger)offset {
+	// Line number equals the number of newlines before the given offset plus one. As offsets are sorted, we can find the number with binary search for the first newline at or after the offset.
+	if (offset == NSNotFound || offset > [_string length]) return NSNotFound;
+	const NSUInteger *offsets = [_newlineOffsets bytes];
+	NSUInteger low = 0;
+	NSUInteger high = _numberOfNewlines;
+	while (low < high) {
+		NSUInteger middle = low + (high - low) / 2;
+		if (offsets[middle] < offset)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return low + 1;
+}
+
+#pragma mark Helper methods
+
+- (NSData *)newlineOffsetsOfString:(NSString *)string {
+	// Scan the string in chunks to avoid messaging for each character.
+	NSCharacterSet *newlines = [NSCharacterSet newlineCharacterSet];
+	NSMutableData *result = [NSMutableData data];
+	NSUInteger length = [string length];
+	unichar buffer[4096];
+	for (NSUInteger start = 0; start < length; start += 4096) {
+		NSUInteger count = MIN(4096, length - start);
+		[string getCharacters:buffer range:NSMakeRange(start, count)];
+		for (NSUInteger i=0; i<count; i++) {
+			if (![newlines characterIsMember:buffer[i]]) continue;
+			NSUInteger offset = start + i;
+			[result appendBytes:&offset length:sizeof(NSUInteger)];
+		}
+	}
+	return result;
+}
+
+#pragma mark Properties
+
+@synthesize string = _string;
+
+@end
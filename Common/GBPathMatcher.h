@@ -0,0 +1,63 @@
+//
+//  GBPathMatcher.h
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/** Matches paths against a set of suffixes.
+ 
+ All suffixes are compiled into a single trie of reversed UTF-8 bytes when the matcher is created. Matching walks the path bytes from the end down the trie, so the cost depends on the length of the longest matching suffix instead of the number of suffixes. The result is the same as testing the path with `[NSString hasSuffix:]` for each suffix, except that comparison is done on UTF-8 bytes. Empty suffixes never match, as with `hasSuffix:`.
+ 
+ Matcher is immutable once created, so it can be used from multiple threads concurrently.
+ */
+@interface GBPathMatcher : NSObject {
+	@private
+	NSMutableData *_nodes;
+}
+
+///---------------------------------------------------------------------------------------
+/// @name Initialization & disposal
+///---------------------------------------------------------------------------------------
+
+/** Returns autoreleased matcher for the given suffixes.
+ 
+ @param suffixes The array of `NSString` suffixes to match.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given array is `nil`.
+ */
++ (id)matcherWithSuffixes:(NSArray *)suffixes;
+
+/** Initializes the matcher for the given suffixes.
+ 
+ This is the designated initializer.
+ 
+ @param suffixes The array of `NSString` suffixes to match.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given array is `nil`.
+ */
+- (id)initWithSuffixes:(NSArray *)suffixes;
+
+///---------------------------------------------------------------------------------------
+/// @name Matching
+///---------------------------------------------------------------------------------------
+
+/** Determines whether the given path ends with any of the suffixes.
+ 
+ @param path The path to test.
+ @return Returns `YES` if the path ends with any of the suffixes, `NO` otherwise.
+ */
+- (BOOL)matchesPath:(NSString *)path;
+
+/** Determines whether the given UTF-8 bytes end with any of the suffixes.
+ 
+ @param bytes The UTF-8 bytes of the path to test.
+ @param length The number of bytes.
+ @return Returns `YES` if the bytes end with any of the suffixes, `NO` otherwise.
+ */
+- (BOOL)matchesBytes:(const char *)bytes length:(NSUInteger)length;
+
+@end
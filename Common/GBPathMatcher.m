@@ -0,0 +1,100 @@
+//
+//  GBPathMatcher.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBPathMatcher.h"
+
+// Trie nodes are stored in a flat array; children of each node are linked through siblings. Index 0 is the root, which is never a child, so 0 also marks missing child or sibling.
+typedef struct {
+	char byte;
+	BOOL terminal;
+	NSUInteger child;
+	NSUInteger sibling;
+} GBPathMatcherNode;
+
+@interface GBPathMatcher ()
+
+- (void)addSuffix:(NSString *)suffix;
+- (NSUInteger)childOfNode:(NSUInteger)node withByte:(char)byte;
+
+@end
+
+#pragma mark -
+
+@implementation GBPathMatcher
+
+#pragma mark Initialization & disposal
+
++ (id)matcherWithSuffixes:(NSArray *)suffixes {
+	return [[[self alloc] initWithSuffixes:suffixes] autorelease];
+}
+
+- (id)initWithSuffixes:(NSArray *)suffixes {
+	NSParameterAssert(suffixes != nil);
+	self = [super init];
+	if (self) {
+		_nodes = [[NSMutableData alloc] initWithLength:sizeof(GBPathMatcherNode)];
+		for (NSString *suffix in suffixes) [self addSuffix:suffix];
+	}
+	return self;
+}
+
+- (void)dealloc {
+	[_nodes release];
+	[super dealloc];
+}
+
+#pragma mark Compiling
+
+- (void)addSuffix:(NSString *)suffix {
+	const char *bytes = [suffix UTF8String];
+	NSUInteger length = strlen(bytes);
+	if (length == 0) return;
+	NSUInteger node = 0;
+	for (NSUInteger i=length; i>0; i--) {
+		char byte = bytes[i - 1];
+		NSUInteger child = [self childOfNode:node withByte:byte];
+		if (child == 0) {
+			// Appending may move the array, so we only take node pointers after that.
+			child = [_nodes length] / sizeof(GBPathMatcherNode);
+			[_nodes increaseLengthBy:sizeof(GBPathMatcherNode)];
+			GBPathMatcherNode *nodes = [_nodes mutableBytes];
+			nodes[child].byte = byte;
+			nodes[child].sibling = nodes[node].child;
+			nodes[node].child = child;
+		}
+		node = child;
+	}
+	((GBPathMatcherNode *)[_nodes mutableBytes])[node].terminal = YES;
+}
+
+- (NSUInteger)childOfNode:(NSUInteger)node withByte:(char)byte {
+	const GBPathMatcherNode *nodes = [_nodes bytes];
+	NSUInteger child = nodes[node].child;
+	while (child != 0 && nodes[child].byte != byte) child = nodes[child].sibling;
+	return child;
+}
+
+#pragma mark Matching
+
+- (BOOL)matchesPath:(NSString *)path {
+	const char *bytes = [path UTF8String];
+	return [self matchesBytes:bytes length:strlen(bytes)];
+}
+
+- (BOOL)matchesBytes:(const char *)bytes length:(NSUInteger)length {
+	const GBPathMatcherNode *nodes = [_nodes bytes];
+	NSUInteger node = 0;
+	for (NSUInteger i=length; i>0; i--) {
+		node = [self childOfNode:node withByte:bytes[i - 1]];
+		if (node == 0) return NO;
+		if (nodes[node].terminal) return YES;
+	}
+	return NO;
+}
+
+@end
@@ -0,0 +1,150 @@
+//
+//  GBProfiler.h
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/** Describes a point in time at which a profiled phase started.
+
+ Samples are taken with `GBProfilerSampleNow()`, usually through `GBProfileBegin()` macro. If profiling is disabled, all fields are zero.
+ */
+typedef struct {
+	uint64_t wallTime;
+	uint64_t cpuTime;
+} GBProfilerSample;
+
+/** Indicates whether profiling is enabled; use `[GBProfiler setEnabled:]` to change it. */
+extern BOOL GBProfilerEnabled;
+
+/** Returns the sample of current wall clock and current thread CPU time or zero sample if profiling is disabled. */
+extern GBProfilerSample GBProfilerSampleNow(void);
+
+/** Returns current resident memory size of the process in bytes or 0 if it can't be determined.
+
+ Unlike peak resident size written to the report, this can be used to measure memory used by a part of the run, for example by the model of parsed objects.
+ */
+extern unsigned long long GBProfilerResidentSize(void);
+
+/** Starts measuring a phase; the sample is stored to a local variable with the given name. */
+#define GBProfileBegin(name) GBProfilerSample name = GBProfilerSampleNow()
+
+/** Records the phase started with `GBProfileBegin()` with the given sample name. */
+#define GBProfileEnd(name,phase) do { if (name.wallTime) [[GBProfiler sharedProfiler] recordPhase:phase sinceSample:name]; } while(0)
+
+/** Records the phase started with `GBProfileBegin()` with the given sample name for the given source file. The path is only evaluated when profiling is enabled. */
+#define GBProfileEndFile(name,phase,file) do { if (name.wallTime) [[GBProfiler sharedProfiler] recordPhase:phase sinceSample:name file:file]; } while(0)
+
+/** Records the phase started with `GBProfileBegin()` with the given sample name for the given object. The object is only evaluated when profiling is enabled. */
+#define GBProfileEndObject(name,phase,obj) do { if (name.wallTime) [[GBProfiler sharedProfiler] recordPhase:phase sinceSample:name object:obj]; } while(0)
+
+/** Increments the given counter by the given value if profiling is enabled. */
+#define GBProfileCount(counter,value) do { if (GBProfilerEnabled) [[GBProfiler sharedProfiler] incrementCounter:counter by:value]; } while(0)
+
+extern NSString *kGBProfilerPhaseDiscover;
+extern NSString *kGBProfilerPhaseRead;
+extern NSString *kGBProfilerPhaseTokenize;
+extern NSString *kGBProfilerPhaseParse;
+extern NSString *kGBProfilerPhaseMatch;
+extern NSString *kGBProfilerPhaseComments;
+extern NSString *kGBProfilerPhaseCrossReferences;
+extern NSString *kGBProfilerPhaseRender;
+extern NSString *kGBProfilerPhaseWrite;
+
+/** Collects timings and counters of hot code paths and writes them as a machine readable report.
+
+ Instrumented code measures phases by taking a sample before the phase and passing it to the profiler after the phase is done. This is done through macros which do nothing more than testing a global flag when profiling is disabled, so instrumentation can stay in hot paths:
+
+	GBProfileBegin(sample);
+	[tokenizer tokenize];
+	GBProfileEndFile(sample, kGBProfilerPhaseTokenize, path);
+
+ For each phase, the profiler accumulates wall clock time, CPU time of the measuring thread and the number of measurements. Phases recorded for a file or an object additionally accumulate the time per file or object, so that the slowest ones can be reported. All methods are thread safe, so phases can be measured from concurrent workers; in such case wall times of phases are summed over all workers and may exceed total run time.
+
+ The report is written in JSON format by `writeReportToFile:error:`, see the method for details.
+ */
+@interface GBProfiler : NSObject {
+	@private
+	NSMutableDictionary *_phases;
+	NSMutableDictionary *_counters;
+	NSMutableDictionary *_files;
+	NSMutableDictionary *_objects;
+	uint64_t _startTime;
+}
+
+///---------------------------------------------------------------------------------------
+/// @name Initialization & disposal
+///---------------------------------------------------------------------------------------
+
+/** Returns the process-wide profiler instance. */
++ (GBProfiler *)sharedProfiler;
+
+/** Enables or disables profiling.
+
+ Enabling profiling also resets all data collected so far and starts measuring total run time. Profiling is disabled by default.
+
+ @param value `YES` to enable profiling, `NO` to disable it.
+ */
++ (void)setEnabled:(BOOL)value;
+
+///---------------------------------------------------------------------------------------
+/// @name Recording
+///---------------------------------------------------------------------------------------
+
+/** Records the given phase that started at the given sample.
+
+ @param phase The name of the phase.
+ @param sample The sample taken at the start of the phase.
+ @see recordPhase:sinceSample:file:
+ @see recordPhase:sinceSample:object:
+ */
+- (void)recordPhase:(NSString *)phase sinceSample:(GBProfilerSample)sample;
+
+/** Records the given phase that started at the given sample for the given file.
+
+ @param phase The name of the phase.
+ @param sample The sample taken at the start of the phase.
+ @param path The path of the file the phase was handling.
+ @see recordPhase:sinceSample:
+ */
+- (void)recordPhase:(NSString *)phase sinceSample:(GBProfilerSample)sample file:(NSString *)path;
+
+/** Records the given phase that started at the given sample for the given object.
+
+ The object is identified by its description, so all phases for the same object are accumulated together.
+
+ @param phase The name of the phase.
+ @param sample The sample taken at the start of the phase.
+ @param object The object the phase was handling.
+ @see recordPhase:sinceSample:
+ */
+- (void)recordPhase:(NSString *)phase sinceSample:(GBProfilerSample)sample object:(id)object;
+
+/** Increments the given counter by the given value.
+
+ @param counter The name of the counter.
+ @param value The value to add to the counter.
+ */
+- (void)incrementCounter:(NSString *)counter by:(NSUInteger)value;
+
+///---------------------------------------------------------------------------------------
+/// @name Reporting
+///---------------------------------------------------------------------------------------
+
+/** Writes collected data as JSON report to the given file.
+
+ The report is a single object with `wallTime` and `cpuTime` of the whole process in seconds, `peakResidentSize` in bytes, `phases` object containing `wallTime`, `cpuTime` and `count` for each phase, `counters` object with the values of all counters and `slowestFiles` and `slowestObjects` arrays listing up to `maximumNumberOfSlowestItems` items with their total `wallTime`, sorted from the slowest one.
+
+ @param path The path to the report file.
+ @param error If writting fails, error description is returned here.
+ @return Returns `YES` if the report was written, `NO` otherwise.
+ */
+- (BOOL)writeReportToFile:(NSString *)path error:(NSError **)error;
+
+/** The maximum number of items listed in `slowestFiles` and `slowestObjects` arrays of the report. Defaults to 20. */
+@property (assign) NSUInteger maximumNumberOfSlowestItems;
+
+@end
@@ -0,0 +1,260 @@
+//
+//  GBProfiler.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <mach/mach.h>
+#import <sys/resource.h>
+#import "timing.h"
+#import "GBProfiler.h"
+
+NSString *kGBProfilerPhaseDiscover = @"discover";
+NSString *kGBProfilerPhaseRead = @"read";
+NSString *kGBProfilerPhaseTokenize = @"tokenize";
+NSString *kGBProfilerPhaseParse = @"parse";
+NSString *kGBProfilerPhaseMatch = @"match";
+NSString *kGBProfilerPhaseComments = @"comments";
+NSString *kGBProfilerPhaseCrossReferences = @"crossrefs";
+NSString *kGBProfilerPhaseRender = @"render";
+NSString *kGBProfilerPhaseWrite = @"write";
+
+BOOL GBProfilerEnabled = NO;
+
+static uint64_t GBProfilerCurrentThreadCPUTime(void) {
+	// Returns CPU time used by current thread in microseconds.
+	mach_port_t thread = mach_thread_self();
+	thread_basic_info_data_t info;
+	mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+	kern_return_t result = thread_info(thread, THREAD_BASIC_INFO, (thread_info_t)&info, &count);
+	mach_port_deallocate(mach_task_self(), thread);
+	if (result != KERN_SUCCESS) return 0;
+	uint64_t user = (uint64_t)info.user_time.seconds * 1000000 + info.user_time.microseconds;
+	uint64_t system = (uint64_t)info.system_time.seconds * 1000000 + info.system_time.microseconds;
+	return user + system;
+}
+
+GBProfilerSample GBProfilerSampleNow(void) {
+	GBProfilerSample result = { 0, 0 };
+	if (!GBProfilerEnabled) return result;
+	result.wallTime = GetCurrentTime();
+	result.cpuTime = GBProfilerCurrentThreadCPUTime();
+	return result;
+}
+
+unsigned long long GBProfilerResidentSize(void) {
+	struct task_basic_info info;
+	mach_msg_type_number_t count = TASK_BASIC_INFO_COUNT;
+	kern_return_t result = task_info(mach_task_self(), TASK_BASIC_INFO, (task_info_t)&info, &count);
+	if (result != KERN_SUCCESS) return 0;
+	return info.resident_size;
+}
+
+#pragma mark -
+
+@interface GBProfiler ()
+
+- (void)reset;
+- (void)addTime:(NSTimeInterval)time toItem:(NSString *)item inDictionary:(NSMutableDictionary *)dictionary;
+- (NSArray *)slowestItemsInDictionary:(NSDictionary *)dictionary;
+- (NSString *)JSONStringFromObject:(id)object;
+- (void)appendJSONObject:(id)object toString:(NSMutableString *)string;
+
+@end
+
+#pragma mark -
+
+@implementation GBProfiler
+
+#pragma mark Initialization & disposal
+
++ (GBProfiler *)sharedProfiler {
+	static GBProfiler *result = nil;
+	@synchronized(self) {
+		if (!result) result = [[GBProfiler alloc] init];
+	}
+	return result;
+}
+
++ (void)setEnabled:(BOOL)value {
+	if (value) [[self sharedProfiler] reset];
+	GBProfilerEnabled = value;
+}
+
+- (id)init {
+	self = [super init];
+	if (self) {
+		self.maximumNumberOfSlowestItems = 20;
+		[self reset];
+	}
+	return self;
+}
+
+- (void)reset {
+	@synchronized(self) {
+		[_phases release];
+		[_counters release];
+		[_files release];
+		[_objects release];
+		_phases = [[NSMutableDictionary alloc] init];
+		_counters = [[NSMutableDictionary alloc] init];
+		_files = [[NSMutableDictionary alloc] init];
+		_objects = [[NSMutableDictionary alloc] init];
+		_startTime = GetCurrentTime();
+	}
+}
+
+#pragma mark Recording
+
+- (void)recordPhase:(NSString *)phase sinceSample:(GBProfilerSample)sample {
+	[self recordPhase:phase sinceSample:sample file:nil];
+}
+
+- (void)recordPhase:(NSString *)phase sinceSample:(GBProfilerSample)sample file:(NSString *)path {
+	// Phase data is kept in a C array wrapped in NSMutableData, so recording doesn't create objects except for new phases and items.
+	NSTimeInterval wallTime = SubtractTime(GetCurrentTime(), sample.wallTime);
+	NSTimeInterval cpuTime = (GBProfilerCurrentThreadCPUTime() - sample.cpuTime) / 1000000.0;
+	@synchronized(self) {
+		NSMutableData *data = [_phases objectForKey:phase];
+		if (!data) {
+			data = [NSMutableData dataWithLength:3 * sizeof(NSTimeInterval)];
+			[_phases setObject:data forKey:phase];
+		}
+		NSTimeInterval *values = [data mutableBytes];
+		values[0] += wallTime;
+		values[1] += cpuTime;
+		values[2] += 1.0;
+		if (path) [self addTime:wallTime toItem:path inDictionary:_files];
+	}
+}
+
+- (void)recordPhase:(NSString *)phase sinceSample:(GBProfilerSample)sample object:(id)object {
+	NSTimeInterval wallTime = SubtractTime(GetCurrentTime(), sample.wallTime);
+	[self recordPhase:phase sinceSample:sample];
+	if (!object) return;
+	@synchronized(self) {
+		[self addTime:wallTime toItem:[object description] inDictionary:_objects];
+	}
+}
+
+- (void)incrementCounter:(NSString *)counter by:(NSUInteger)value {
+	@synchronized(self) {
+		NSUInteger current = [[_counters objectForKey:counter] unsignedIntegerValue];
+		[_counters setObject:[NSNumber numberWithUnsignedInteger:current + value] forKey:counter];
+	}
+}
+
+- (void)addTime:(NSTimeInterval)time toItem:(NSString *)item inDictionary:(NSMutableDictionary *)dictionary {
+	NSTimeInterval current = [[dictionary objectForKey:item] doubleValue];
+	[dictionary setObject:[NSNumber numberWithDouble:current + time] forKey:item];
+}
+
+#pragma mark Reporting
+
+- (BOOL)writeReportToFile:(NSString *)path error:(NSError **)error {
+	NSMutableDictionary *report = [NSMutableDictionary dictionary];
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	NSTimeInterval cpuTime = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000000.0;
+	[report setObject:[NSNumber numberWithDouble:cpuTime] forKey:@"cpuTime"];
+	[report setObject:[NSNumber numberWithLong:usage.ru_maxrss] forKey:@"peakResidentSize"];
+
+	@synchronized(self) {
+		[report setObject:[NSNumber numberWithDouble:SubtractTime(GetCurrentTime(), _startTime)] forKey:@"wallTime"];
+		NSMutableDictionary *phases = [NSMutableDictionary dictionaryWithCapacity:[_phases count]];
+		[_phases enumerateKeysAndObjectsUsingBlock:^(NSString *phase, NSData *data, BOOL *stop) {
+			const NSTimeInterval *times = [data bytes];
+			NSMutableDictionary *values = [NSMutableDictionary dictionaryWithCapacity:3];
+			[values setObject:[NSNumber numberWithDouble:times[0]] forKey:@"wallTime"];
+			[values setObject:[NSNumber numberWithDouble:times[1]] forKey:@"cpuTime"];
+			[values setObject:[NSNumber numberWithUnsignedInteger:(NSUInteger)times[2]] forKey:@"count"];
+			[phases setObject:values forKey:phase];
+		}];
+		[report setObject:phases forKey:@"phases"];
+		[report setObject:[[_counters copy] autorelease] forKey:@"counters"];
+		[report setObject:[self slowestItemsInDictionary:_files] forKey:@"slowestFiles"];
+		[report setObject:[self slowestItemsInDictionary:_objects] forKey:@"slowestObjects"];
+	}
+
+	NSString *json = [self JSONStringFromObject:report];
+	return [json writeToFile:[path stringByStandardizingPath] atomically:YES encoding:NSUTF8StringEncoding error:error];
+}
+
+- (NSArray *)slowestItemsInDictionary:(NSDictionary *)dictionary {
+	NSArray *items = [dictionary keysSortedByValueUsingComparator:^(id obj1, id obj2) {
+		return [obj2 compare:obj1];
+	}];
+	NSUInteger count = MIN([items count], self.maximumNumberOfSlowestItems);
+	NSMutableArray *result = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger i=0; i<count; i++) {
+		NSString *item = [items objectAtIndex:i];
+		NSDictionary *data = [NSDictionary dictionaryWithObjectsAndKeys:item, @"name", [dictionary objectForKey:item], @"wallTime", nil];
+		[result addObject:data];
+	}
+	return result;
+}
+
+#pragma mark JSON handling
+
+- (NSString *)JSONStringFromObject:(id)object {
+	NSMutableString *result = [NSMutableString string];
+	[self appendJSONObject:object toString:result];
+	[result appendString:@"\n"];
+	return result;
+}
+
+- (void)appendJSONObject:(id)object toString:(NSMutableString *)string {
+	// We only need to handle the types we put into the report. Dictionary keys are sorted so that reports of different runs can be compared with diff.
+	if ([object isKindOfClass:[NSDictionary class]]) {
+		[string appendString:@"{"];
+		NSArray *keys = [[object allKeys] sortedArrayUsingSelector:@selector(compare:)];
+		[keys enumerateObjectsUsingBlock:^(id key, NSUInteger idx, BOOL *stop) {
+			if (idx > 0) [string appendString:@","];
+			[self appendJSONObject:key toString:string];
+			[string appendString:@":"];
+			[self appendJSONObject:[object objectForKey:key] toString:string];
+		}];
+		[string appendString:@"}"];
+	} else if ([object isKindOfClass:[NSArray class]]) {
+		[string appendString:@"["];
+		[object enumerateObjectsUsingBlock:^(id item, NSUInteger idx, BOOL *stop) {
+			if (idx > 0) [string appendString:@","];
+			[self appendJSONObject:item toString:string];
+		}];
+		[string appendString:@"]"];
+	} else if ([object isKindOfClass:[NSNumber class]]) {
+		const char *type = [object objCType];
+		if (strcmp(type, @encode(double)) == 0 || strcmp(type, @encode(float)) == 0)
+			[string appendFormat:@"%.6f", [object doubleValue]];
+		else
+			[string appendFormat:@"%lld", [object longLongValue]];
+	} else {
+		NSString *value = [object description];
+		[string appendString:@"\""];
+		for (NSUInteger i=0; i<[value length]; i++) {
+			unichar ch = [value characterAtIndex:i];
+			switch (ch) {
+				case '"': [string appendString:@"\\\""]; break;
+				case '\\': [string appendString:@"\\\\"]; break;
+				case '\n': [string appendString:@"\\n"]; break;
+				case '\r': [string appendString:@"\\r"]; break;
+				case '\t': [string appendString:@"\\t"]; break;
+				default:
+					if (ch < 0x20)
+						[string appendFormat:@"\\u%04x", ch];
+					else
+						[string appendFormat:@"%C", ch];
+					break;
+			}
+		}
+		[string appendString:@"\""];
+	}
+}
+
+#pragma mark Properties
+
+@synthesize maximumNumberOfSlowestItems;
+
+@end
@@ -0,0 +1,48 @@
+//
+//  GBSymbol.h
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/** Interned immutable string used for names of classes, categories, protocols and for method selectors.
+ 
+ Symbols are obtained with `symbolWithString:`, which returns the same instance for all equal strings during the whole run. This has several benefits for names that are repeated through parsed source files and used as dictionary keys: each name is stored only once, two symbols are equal only if they are the same instance and the hash of each symbol is computed only once, when the symbol is created. As symbols are `NSString`s, they can be used wherever names were used before and compare equal to ordinary strings with the same value, so clients can still look up objects by plain strings.
+ 
+ The symbol table is shared by all clients and is thread safe, so symbols can be created from concurrent parsing workers. Symbols are never released.
+ */
+@interface GBSymbol : NSString {
+	@private
+	NSString *_string;
+	NSUInteger _hash;
+}
+
+///---------------------------------------------------------------------------------------
+/// @name Symbols handling
+///---------------------------------------------------------------------------------------
+
+/** Returns the symbol for the given string.
+ 
+ If the string is already a symbol, it's returned as is. Otherwise the symbol table is searched for an existing symbol with the same value and a new symbol is created and added to the table if none is found.
+ 
+ @param string The string value of the symbol or `nil`.
+ @return Returns the symbol or `nil` if the given string is `nil`.
+ */
++ (id)symbolWithString:(NSString *)string;
+
+/** Returns the array of symbols for the given array of strings.
+ 
+ This is useful for interning components of method signatures, where the same few strings are repeated through all methods. Objects that aren't strings are copied to the resulting array unchanged.
+ 
+ @param strings The array of strings or `nil`.
+ @return Returns the array of symbols or `nil` if the given array is `nil`.
+ */
++ (NSArray *)symbolsWithStrings:(NSArray *)strings;
+
+/** Returns the number of symbols in the symbol table. */
++ (NSUInteger)numberOfSymbols;
+
+@end
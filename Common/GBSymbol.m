@@ -0,0 +1,120 @@
+//
+//  GBSymbol.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBSymbol.h"
+
+static NSMutableSet *GBSymbolTable = nil;
+
+@interface GBSymbol ()
+
+- (id)initWithString:(NSString *)string;
+
+@end
+
+#pragma mark -
+
+@implementation GBSymbol
+
+#pragma mark Symbols handling
+
++ (void)initialize {
+	if (self != [GBSymbol class]) return;
+	GBSymbolTable = [[NSMutableSet alloc] init];
+}
+
++ (id)symbolWithString:(NSString *)string {
+	if (!string || [string isKindOfClass:[GBSymbol class]]) return string;
+	@synchronized(GBSymbolTable) {
+		// Existing symbols compare equal to the given string and have the same hash, so we can use it for searching directly.
+		GBSymbol *result = [GBSymbolTable member:string];
+		if (!result) {
+			result = [[GBSymbol alloc] initWithString:string];
+			[GBSymbolTable addObject:result];
+			[result release];
+		}
+		return result;
+	}
+}
+
++ (NSArray *)symbolsWithStrings:(NSArray *)strings {
+	if (!strings) return nil;
+	NSUInteger count = [strings count];
+	if (count == 0) return strings;
+	id *symbols = malloc(count * sizeof(id));
+	for (NSUInteger i=0; i<count; i++) {
+		id object = [strings objectAtIndex:i];
+		symbols[i] = [object isKindOfClass:[NSString class]] ? [self symbolWithString:object] : object;
+	}
+	NSArray *result = [NSArray arrayWithObjects:symbols count:count];
+	free(symbols);
+	return result;
+}
+
++ (NSUInteger)numberOfSymbols {
+	@synchronized(GBSymbolTable) {
+		return [GBSymbolTable count];
+	}
+}
+
+- (id)initWithString:(NSString *)string {
+	self = [super init];
+	if (self) {
+		_string = [string copy];
+		_hash = [_string hash];
+	}
+	return self;
+}
+
+- (void)dealloc {
+	[_string release];
+	[super dealloc];
+}
+
+#pragma mark Overriden methods
+
+- (NSUInteger)hash {
+	return _hash;
+}
+
+- (BOOL)isEqual:(id)object {
+	if (object == self) return YES;
+	if ([object isKindOfClass:[GBSymbol class]]) return NO;
+	return [_string isEqual:object];
+}
+
+- (BOOL)isEqualToString:(NSString *)string {
+	if (string == self) return YES;
+	if ([string isKindOfClass:[GBSymbol class]]) return NO;
+	return [_string isEqualToString:string];
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+	return [self retain];
+}
+
+- (NSUInteger)length {
+	return [_string length];
+}
+
+- (unichar)characterAtIndex:(NSUInteger)index {
+	return [_string characterAtIndex:index];
+}
+
+- (void)getCharacters:(unichar *)buffer range:(NSRange)range {
+	[_string getCharacters:buffer range:range];
+}
+
+- (const char *)UTF8String {
+	return [_string UTF8String];
+}
+
+- (NSString *)description {
+	return _string;
+}
+
+@end
@@ -125,9 +125,18 @@
 }
 
 - (NSUInteger)numberOfLinesInRange:(NSRange)range {
-	NSString *substring = [self substringWithRange:range];
-	NSArray *lines = [substring componentsSeparatedByCharactersInSet:[NSCharacterSet newlineCharacterSet]];
-	return [lines count];
+	// Count newline characters in place instead of splitting a substring into lines. Note that clients needing many line numbers for the same string should use GBLineIndex instead.
+	NSCharacterSet *newlines = [NSCharacterSet newlineCharacterSet];
+	NSUInteger result = 1;
+	NSUInteger end = NSMaxRange(range);
+	NSRange search = range;
+	while (search.length > 0) {
+		NSRange found = [self rangeOfCharacterFromSet:newlines options:NSLiteralSearch range:search];
+		if (found.location == NSNotFound) break;
+		result++;
+		search = NSMakeRange(NSMaxRange(found), end - NSMaxRange(found));
+	}
+	return result;
 }
 
 @end
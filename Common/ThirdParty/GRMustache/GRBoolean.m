@@ -27,10 +27,14 @@ static GRYes *yes = nil;
 
 @implementation GRYes
 
-+ (GRYes *)yes {
-    if (yes == nil) {
++ (void)initialize {
+	// The runtime serializes +initialize, so the singleton is safely created even when first used from concurrent threads.
+	if (self == [GRYes class] && yes == nil) {
 		yes = [[super allocWithZone:NULL] init];
 	}
+}
+
++ (GRYes *)yes {
 	return yes;
 }
 
@@ -76,10 +80,14 @@ static GRNo *no = nil;
 
 @implementation GRNo
 
-+ (GRNo *)no {
-    if (no == nil) {
++ (void)initialize {
+	// The runtime serializes +initialize, so the singleton is safely created even when first used from concurrent threads.
+	if (self == [GRNo class] && no == nil) {
 		no = [[super allocWithZone:NULL] init];
 	}
+}
+
++ (GRNo *)no {
 	return no;
 }
 
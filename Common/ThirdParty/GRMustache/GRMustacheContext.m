@@ -32,14 +32,34 @@
 #import "GRMustacheContext_private.h"
 
 
+#import <pthread.h>
+
+
 static NSInteger BOOLPropertyType = NSNotFound;
 
-@interface GRMustacheProperty: NSObject
+typedef enum {
+	GRMustacheAccessorKindKeyValueCoding,
+	GRMustacheAccessorKindDictionary,
+	GRMustacheAccessorKindMethod,
+} GRMustacheAccessorKind;
+
+// Describes how to read the value of a key from instances of a class. Accessors are resolved
+// once per (class, key) pair and cached, so rendering doesn't repeat runtime and KVC lookups
+// for every tag of every rendered object.
+@interface GRMustacheAccessor: NSObject {
+@public
+	GRMustacheAccessorKind kind;
+	SEL selector;
+	IMP implementation;
+	char returnType;
+	BOOL BOOLProperty;
+}
 @property BOOL BOOLProperty;
-+ (BOOL)class:(Class)class hasBOOLPropertyNamed:(NSString *)propertyName;
++ (GRMustacheAccessor *)accessorForKey:(NSString *)key ofClass:(Class)class;
+- (id)valueForKey:(NSString *)key ofObject:(id)object;
 @end
 
-@implementation GRMustacheProperty
+@implementation GRMustacheAccessor
 @dynamic BOOLProperty;
 
 + (NSInteger)typeForPropertyNamed:(NSString *)propertyName ofClass:(Class)class {
@@ -59,31 +79,129 @@ static NSInteger BOOLPropertyType = NSNotFound;
 	return NSNotFound;
 }
 
-+ (BOOL)class:(Class)class hasBOOLPropertyNamed:(NSString *)propertyName {
-	static NSMutableDictionary *classes = nil;
-	
-	if (classes == nil) {
-		classes = [[NSMutableDictionary dictionaryWithCapacity:12] retain];
++ (char)returnTypeOfMethod:(Method)method {
+	char type[32];
+	method_getReturnType(method, type, sizeof(type));
+	const char *cursor = type;
+	while (*cursor && strchr("rnNoORV", *cursor)) {
+		cursor++;
 	}
-	
-	NSMutableDictionary *propertyNames = [classes objectForKey:class];
-	if (propertyNames == nil) {
-		propertyNames = [[NSMutableDictionary dictionaryWithCapacity:4] retain];
-		[classes setObject:propertyNames forKey:class];
+	return *cursor;
+}
+
++ (GRMustacheAccessor *)resolvedAccessorForKey:(NSString *)key ofClass:(Class)class {
+	GRMustacheAccessor *accessor = [[[GRMustacheAccessor alloc] init] autorelease];
+	accessor->kind = GRMustacheAccessorKindKeyValueCoding;
+	if (BOOLPropertyType == NSNotFound) {
+		BOOLPropertyType = [self typeForPropertyNamed:@"BOOLProperty" ofClass:self];
 	}
+	accessor->BOOLProperty = ([self typeForPropertyNamed:key ofClass:class] == BOOLPropertyType);
 	
-	NSNumber *boolNumber = [propertyNames objectForKey:propertyName];
-	if (boolNumber == nil) {
-		if (BOOLPropertyType == NSNotFound) {
-			BOOLPropertyType = [self typeForPropertyNamed:@"BOOLProperty" ofClass:self];
+	// Only bypass KVC when we know it would end up with the same result: dictionaries using the
+	// stock NSDictionary implementation, or objects using the stock NSObject implementation and
+	// having a plain getter (KVC would prefer -getKey if present).
+	SEL valueForKeySelector = @selector(valueForKey:);
+	IMP valueForKeyImplementation = class_getMethodImplementation(class, valueForKeySelector);
+	if ([class isSubclassOfClass:[NSDictionary class]]) {
+		if (valueForKeyImplementation == class_getMethodImplementation([NSDictionary class], valueForKeySelector) && ![key hasPrefix:@"@"]) {
+			accessor->kind = GRMustacheAccessorKindDictionary;
 		}
-		BOOL booleanProperty = ([self typeForPropertyNamed:propertyName ofClass:class] == BOOLPropertyType);
-		[propertyNames setObject:[NSNumber numberWithBool:booleanProperty] forKey:propertyName];
-		return booleanProperty;
+		return accessor;
+	}
+	if (valueForKeyImplementation != class_getMethodImplementation([NSObject class], valueForKeySelector) || key.length == 0) {
+		return accessor;
+	}
+	NSString *getterName = [NSString stringWithFormat:@"get%@%@", [[key substringToIndex:1] uppercaseString], [key substringFromIndex:1]];
+	if (class_getInstanceMethod(class, NSSelectorFromString(getterName)) != NULL) {
+		return accessor;
+	}
+	SEL selector = NSSelectorFromString(key);
+	Method method = class_getInstanceMethod(class, selector);
+	if (method == NULL || method_getNumberOfArguments(method) != 2) {
+		return accessor;
 	}
+	char returnType = [self returnTypeOfMethod:method];
+	if (returnType == '\0' || !strchr("@#cCBsSiIlLqQfd", returnType)) {
+		return accessor;
+	}
+	accessor->kind = GRMustacheAccessorKindMethod;
+	accessor->selector = selector;
+	accessor->implementation = method_getImplementation(method);
+	accessor->returnType = returnType;
+	return accessor;
+}
+
++ (GRMustacheAccessor *)accessorForKey:(NSString *)key ofClass:(Class)class {
+	static NSMapTable *classes = nil;
+	static pthread_rwlock_t lock = PTHREAD_RWLOCK_INITIALIZER;
 	
-	return [boolNumber boolValue];
+	pthread_rwlock_rdlock(&lock);
+	GRMustacheAccessor *accessor = [(NSDictionary *)[classes objectForKey:class] objectForKey:key];
+	pthread_rwlock_unlock(&lock);
+	if (accessor) {
+		return accessor;
+	}
+	
+	accessor = [self resolvedAccessorForKey:key ofClass:class];
+	pthread_rwlock_wrlock(&lock);
+	if (classes == nil) {
+		classes = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsOpaqueMemory | NSPointerFunctionsOpaquePersonality
+											valueOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPersonality
+												capacity:64];
+	}
+	NSMutableDictionary *accessors = [classes objectForKey:class];
+	if (accessors == nil) {
+		accessors = [NSMutableDictionary dictionaryWithCapacity:16];
+		[classes setObject:accessors forKey:class];
+	}
+	[accessors setObject:accessor forKey:key];
+	pthread_rwlock_unlock(&lock);
+	return accessor;
+}
 
+- (id)valueForKey:(NSString *)key ofObject:(id)object {
+	switch (kind) {
+		case GRMustacheAccessorKindDictionary:
+			return [(NSDictionary *)object objectForKey:key];
+			
+		case GRMustacheAccessorKindMethod:
+			switch (returnType) {
+				case '@':
+				case '#':
+					return ((id (*)(id, SEL))implementation)(object, selector);
+				case 'c':
+					return [NSNumber numberWithChar:((char (*)(id, SEL))implementation)(object, selector)];
+				case 'C':
+					return [NSNumber numberWithUnsignedChar:((unsigned char (*)(id, SEL))implementation)(object, selector)];
+				case 'B':
+					return [NSNumber numberWithBool:((bool (*)(id, SEL))implementation)(object, selector)];
+				case 's':
+					return [NSNumber numberWithShort:((short (*)(id, SEL))implementation)(object, selector)];
+				case 'S':
+					return [NSNumber numberWithUnsignedShort:((unsigned short (*)(id, SEL))implementation)(object, selector)];
+				case 'i':
+					return [NSNumber numberWithInt:((int (*)(id, SEL))implementation)(object, selector)];
+				case 'I':
+					return [NSNumber numberWithUnsignedInt:((unsigned int (*)(id, SEL))implementation)(object, selector)];
+				case 'l':
+					return [NSNumber numberWithLong:((long (*)(id, SEL))implementation)(object, selector)];
+				case 'L':
+					return [NSNumber numberWithUnsignedLong:((unsigned long (*)(id, SEL))implementation)(object, selector)];
+				case 'q':
+					return [NSNumber numberWithLongLong:((long long (*)(id, SEL))implementation)(object, selector)];
+				case 'Q':
+					return [NSNumber numberWithUnsignedLongLong:((unsigned long long (*)(id, SEL))implementation)(object, selector)];
+				case 'f':
+					return [NSNumber numberWithFloat:((float (*)(id, SEL))implementation)(object, selector)];
+				case 'd':
+					return [NSNumber numberWithDouble:((double (*)(id, SEL))implementation)(object, selector)];
+			}
+			break;
+			
+		case GRMustacheAccessorKindKeyValueCoding:
+			break;
+	}
+	return [object valueForKey:key];
 }
 
 @end
@@ -93,7 +211,7 @@ static NSInteger BOOLPropertyType = NSNotFound;
 @property (nonatomic, retain) id object;
 @property (nonatomic, retain) GRMustacheContext *parent;
 - (id)initWithObject:(id)object parent:(GRMustacheContext *)parent;
-- (BOOL)shouldConsiderObjectValue:(id)value forKey:(NSString *)key asBoolean:(BOOL *)outBool;
+- (BOOL)shouldConsiderObjectValue:(id)value withAccessor:(GRMustacheAccessor *)accessor asBoolean:(BOOL *)outBool;
 - (id)valueForKeyComponent:(NSString *)key foundInContext:(GRMustacheContext **)outContext;
 @end
 
@@ -169,8 +287,12 @@ static NSInteger BOOLPropertyType = NSNotFound;
 
 - (id)valueForKeyComponent:(NSString *)key foundInContext:(GRMustacheContext **)outContext {
 	id value = nil;
+	GRMustacheAccessor *accessor = nil;
+	if (object != nil) {
+		accessor = [GRMustacheAccessor accessorForKey:key ofClass:[object class]];
+	}
 	@try {
-		value = [object valueForKey:key];
+		value = [accessor valueForKey:key ofObject:object];
 	}
 	@catch (NSException *exception) {
 		if (![[exception name] isEqualToString:NSUndefinedKeyException] ||
@@ -187,7 +309,7 @@ static NSInteger BOOLPropertyType = NSNotFound;
 			*outContext = self;
 		}
 		BOOL boolValue;
-		if ([self shouldConsiderObjectValue:value forKey:key asBoolean:&boolValue]) {
+		if ([self shouldConsiderObjectValue:value withAccessor:accessor asBoolean:&boolValue]) {
 			if (boolValue) {
 				return [GRYes yes];
 			} else {
@@ -204,7 +326,7 @@ static NSInteger BOOLPropertyType = NSNotFound;
 	return [parent valueForKeyComponent:key foundInContext:outContext];
 }
 
-- (BOOL)shouldConsiderObjectValue:(id)value forKey:(NSString *)key asBoolean:(BOOL *)outBool {
+- (BOOL)shouldConsiderObjectValue:(id)value withAccessor:(GRMustacheAccessor *)accessor asBoolean:(BOOL *)outBool {
 	// C99 bool type
 	if (CFBooleanGetTypeID() == CFGetTypeID(value)) {
 		if (outBool) {
@@ -213,7 +335,7 @@ static NSInteger BOOLPropertyType = NSNotFound;
 		return YES;
 	}
 	
-	if (![GRMustache strictBooleanMode] && [value isKindOfClass:[NSNumber class]] && [GRMustacheProperty class:[object class] hasBOOLPropertyNamed:key]) {
+	if (![GRMustache strictBooleanMode] && [value isKindOfClass:[NSNumber class]] && accessor && accessor->BOOLProperty) {
 		if (outBool) {
 			*outBool = [(NSNumber *)value boolValue];
 		}
@@ -22,6 +22,7 @@
 
 #import "GRMustacheElement_private.h"
 #import "GRMustacheElement.h"
+#import "GRMustacheTemplate.h"
 
 
 @implementation GRMustacheElement
@@ -31,4 +32,8 @@
 	return @"";
 }
 
+- (void)renderContext:(GRMustacheContext *)context toOutput:(id<GRMustacheRenderingOutput>)output {
+	[output appendString:[self renderContext:context]];
+}
+
 @end
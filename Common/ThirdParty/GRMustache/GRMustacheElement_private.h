@@ -24,8 +24,10 @@
 
 
 @class GRMustacheContext;
+@protocol GRMustacheRenderingOutput;
 
 @protocol GRMustacheElement
 @required
 - (NSString *)renderContext:(GRMustacheContext *)context;
+- (void)renderContext:(GRMustacheContext *)context toOutput:(id<GRMustacheRenderingOutput>)output;
 @end
@@ -57,14 +57,19 @@
 }
 
 - (NSString *)renderContext:(GRMustacheContext *)context {
-	id value = [context valueForKey:name];
 	NSMutableString *buffer= [NSMutableString stringWithCapacity:1024];
+	[self renderContext:context toOutput:(id<GRMustacheRenderingOutput>)buffer];
+	return buffer;
+}
+
+- (void)renderContext:(GRMustacheContext *)context toOutput:(id<GRMustacheRenderingOutput>)output {
+	id value = [context valueForKey:name];
 	
 	switch([GRMustache objectKind:value]) {
 		case GRMustacheObjectKindFalseValue:
 			if (inverted) {
 				for (NSObject<GRMustacheElement> *elem in elems) {
-					[buffer appendString:[elem renderContext:context]];
+					[elem renderContext:context toOutput:output];
 				}
 			}
 			break;
@@ -73,7 +78,7 @@
 			if (!inverted) {
 				GRMustacheContext *innerContext = [GRMustacheContext contextWithObject:value parent:context];
 				for (NSObject<GRMustacheElement> *elem in elems) {
-					[buffer appendString:[elem renderContext:innerContext]];
+					[elem renderContext:innerContext toOutput:output];
 				}
 			}
 			break;
@@ -87,14 +92,14 @@
 				}
 				if (empty) {
 					for (NSObject<GRMustacheElement> *elem in elems) {
-						[buffer appendString:[elem renderContext:context]];
+						[elem renderContext:context toOutput:output];
 					}
 				}
 			} else {
 				for (id object in value) {
 					GRMustacheContext *innerContext = [GRMustacheContext contextWithObject:object parent:context];
 					for (NSObject<GRMustacheElement> *elem in elems) {
-						[buffer appendString:[elem renderContext:innerContext]];
+						[elem renderContext:innerContext toOutput:output];
 					}
 				}
 			}
@@ -115,7 +120,7 @@
 					}
 					return (NSString *)result;
 				};
-				[buffer appendString:[(GRMustacheLambdaBlockWrapper *)value renderObject:context
+				[output appendString:[(GRMustacheLambdaBlockWrapper *)value renderObject:context
 																			  fromString:templateString
 																				renderer:renderer]];
 			}
@@ -125,8 +130,6 @@
 			// should not be here
 			NSAssert(NO, nil);
 	}
-	
-	return buffer;
 }
 
 - (void)dealloc {
@@ -25,6 +25,23 @@
 
 @class GRMustacheTemplateLoader;
 
+/**
+ The protocol for objects receiving rendered template contents.
+ 
+ Rendering to an output lets clients process rendered contents as they are produced, for example
+ to write them directly to a file, instead of keeping the whole rendered string in memory.
+ NSMutableString implements the only required method, so it can be used as an output as well.
+ */
+@protocol GRMustacheRenderingOutput <NSObject>
+@required
+/**
+ Appends the given rendered string to the output.
+ 
+ @param string A rendered part of the template
+ */
+- (void)appendString:(NSString *)string;
+@end
+
 
 /**
  The GRMustacheTemplate class provides with Mustache template rendering services.
@@ -122,6 +139,17 @@
  */
 - (NSString *)renderObject:(id)object;
 
+/**
+ Renders a template with a context object into the given output.
+ 
+ Rendered contents are appended to the output as they are produced, so the whole rendered
+ template is never kept in memory.
+ 
+ @param object A context object used for interpreting Mustache tags
+ @param output The output receiving rendered contents
+ */
+- (void)renderObject:(id)object toOutput:(id<GRMustacheRenderingOutput>)output;
+
 /**
  Renders a template without any context object for interpreting Mustache tags.
  
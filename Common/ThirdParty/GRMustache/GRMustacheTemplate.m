@@ -126,12 +126,20 @@
 	return [self renderContext:[GRMustacheContext contextWithObject:object]];
 }
 
+- (void)renderObject:(id)object toOutput:(id<GRMustacheRenderingOutput>)output {
+	[self renderContext:[GRMustacheContext contextWithObject:object] toOutput:output];
+}
+
 - (NSString *)renderContext:(GRMustacheContext *)context {
 	NSMutableString *buffer = [NSMutableString stringWithCapacity:templateString.length];
+	[self renderContext:context toOutput:(id<GRMustacheRenderingOutput>)buffer];
+	return buffer;
+}
+
+- (void)renderContext:(GRMustacheContext *)context toOutput:(id<GRMustacheRenderingOutput>)output {
 	for (NSObject<GRMustacheElement> *elem in elems) {
-		[buffer appendString:[elem renderContext:context]];
+		[elem renderContext:context toOutput:output];
 	}
-	return buffer;
 }
 
 
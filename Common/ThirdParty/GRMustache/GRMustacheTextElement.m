@@ -20,6 +20,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#import "GRMustacheTemplate.h"
 #import "GRMustacheTextElement_private.h"
 
 
@@ -47,6 +48,10 @@
 	return text;
 }
 
+- (void)renderContext:(GRMustacheContext *)context toOutput:(id<GRMustacheRenderingOutput>)output {
+	[output appendString:text];
+}
+
 - (void)dealloc {
 	[text release];
 	[super dealloc];
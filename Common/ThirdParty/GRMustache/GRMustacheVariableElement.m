@@ -71,6 +71,13 @@
 	return @"";
 }
 
+- (void)renderContext:(GRMustacheContext *)context toOutput:(id<GRMustacheRenderingOutput>)output {
+	NSString *string = [self renderContext:context];
+	if (string.length > 0) {
+		[output appendString:string];
+	}
+}
+
 - (void)dealloc {
 	[name release];
 	[super dealloc];
@@ -152,11 +152,10 @@
 	
 	// Run the template and save the results.
 	GBTemplateHandler *handler = [self.templateFiles objectForKey:templatePath];
-	NSString *output = [handler renderObject:vars];
 	NSString *outputPath = [self outputPathToTemplateEndingWith:templateFilename];
 	NSString *filename = [outputPath stringByAppendingPathComponent:@"Nodes.xml"];
 	[self.temporaryFiles addObject:filename];
-	if (![self writeString:output toFile:[filename stringByStandardizingPath] error:error]) {
+	if (![self writeObject:vars withTemplate:handler toFile:[filename stringByStandardizingPath] error:error]) {
 		GBLogWarn(@"Failed writting Nodes.xml to '%@'!", filename);
 		return NO;
 	}
@@ -336,11 +335,10 @@
 		[vars setObject:membersData forKey:@"members"];
 		
 		// Run the template and save the results.
-		NSString *output = [handler renderObject:vars];
 		NSString *indexName = [NSString stringWithFormat:@"Tokens%ld.xml", idx++];
 		NSString *filename = [outputPath stringByAppendingPathComponent:indexName];
 		[self.temporaryFiles addObject:filename];
-		if (![self writeString:output toFile:[filename stringByStandardizingPath] error:error]) {
+		if (![self writeObject:vars withTemplate:handler toFile:[filename stringByStandardizingPath] error:error]) {
 			GBLogWarn(@"Failed writting tokens file '%@'!", filename);
 			*index = idx;
 			return NO;
@@ -0,0 +1,89 @@
+//
+//  GBFileWriter.h
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "GRMustacheTemplate.h"
+
+/** Writes strings to a file through a bounded UTF-8 buffer.
+ 
+ The writer is used as `GRMustacheRenderingOutput` when rendering templates, so rendered contents are converted to UTF-8 and written to the file as they are produced, instead of keeping the whole rendered page in memory. At any time the writer only holds a buffer of fixed size. Contents are written to a temporary file in the same directory, which replaces the destination file when the writer is closed, so the destination is updated atomically:
+ 
+	GBFileWriter *writer = [GBFileWriter writerWithPath:path];
+	if (![writer open:&error]) return NO;
+	[writer appendString:@"Hello "];
+	[writer appendString:@"world"];
+	if (![writer close:&error]) return NO;
+ 
+ As `appendString:` can't report errors, any write error is remembered and reported when closing the writer. In such case the temporary file is removed and the destination file is left unchanged.
+ */
+@interface GBFileWriter : NSObject <GRMustacheRenderingOutput> {
+	@private
+	NSString *_path;
+	NSString *_temporaryPath;
+	NSOutputStream *_stream;
+	NSMutableData *_buffer;
+	NSUInteger _bufferLength;
+	NSError *_error;
+}
+
+///---------------------------------------------------------------------------------------
+/// @name Initialization & disposal
+///---------------------------------------------------------------------------------------
+
+/** Returns autoreleased writer for the given path.
+ 
+ @param path The path of the destination file.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given path is `nil`.
+ */
++ (id)writerWithPath:(NSString *)path;
+
+/** Initializes the writer for the given path.
+ 
+ This is the designated initializer.
+ 
+ @param path The path of the destination file.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given path is `nil`.
+ */
+- (id)initWithPath:(NSString *)path;
+
+///---------------------------------------------------------------------------------------
+/// @name Writing handling
+///---------------------------------------------------------------------------------------
+
+/** Opens the temporary file for writting.
+ 
+ The directory of the destination path must already exist.
+ 
+ @param error If opening fails, error description is returned here.
+ @return Returns `YES` if the file was opened, `NO` otherwise.
+ @see close:
+ */
+- (BOOL)open:(NSError **)error;
+
+/** Appends the given string to the file.
+ 
+ The string is converted to UTF-8 into the buffer, which is written to the file whenever it gets full.
+ 
+ @param string The string to append.
+ */
+- (void)appendString:(NSString *)string;
+
+/** Writes remaining buffered data, closes the file and moves it to destination path.
+ 
+ @param error If writting or moving fails, error description is returned here.
+ @return Returns `YES` if destination file was written, `NO` otherwise.
+ @see open:
+ */
+- (BOOL)close:(NSError **)error;
+
+/** The path of the destination file. */
+@property (readonly) NSString *path;
+
+@end
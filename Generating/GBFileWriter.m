@@ -0,0 +1,143 @@
+//
+//  GBFileWriter.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBProfiler.h"
+#import "GBFileWriter.h"
+
+static NSUInteger kGBFileWriterBufferSize = 64 * 1024;
+
+@interface GBFileWriter ()
+
+- (void)flushBuffer;
+- (void)discardTemporaryFile;
+
+@end
+
+#pragma mark -
+
+@implementation GBFileWriter
+
+#pragma mark Initialization & disposal
+
++ (id)writerWithPath:(NSString *)path {
+	return [[[self alloc] initWithPath:path] autorelease];
+}
+
+- (id)initWithPath:(NSString *)path {
+	NSParameterAssert(path != nil);
+	self = [super init];
+	if (self) {
+		_path = [[path stringByStandardizingPath] copy];
+		_buffer = [[NSMutableData alloc] initWithLength:kGBFileWriterBufferSize];
+		_bufferLength = 0;
+	}
+	return self;
+}
+
+#pragma mark Writing handling
+
+- (BOOL)open:(NSError **)error {
+	// Temporary file is created within the same directory so that it can be renamed to destination atomically.
+	NSString *filename = [NSString stringWithFormat:@".%@.%@", [_path lastPathComponent], [[NSProcessInfo processInfo] globallyUniqueString]];
+	_temporaryPath = [[[_path stringByDeletingLastPathComponent] stringByAppendingPathComponent:filename] copy];
+	_stream = [[NSOutputStream alloc] initToFileAtPath:_temporaryPath append:NO];
+	[_stream open];
+	if ([_stream streamStatus] == NSStreamStatusError) {
+		if (error) *error = [_stream streamError];
+		[self discardTemporaryFile];
+		return NO;
+	}
+	return YES;
+}
+
+- (void)appendString:(NSString *)string {
+	// Convert the string directly into the buffer, flushing it whenever it gets full. This way we never need a complete UTF-8 copy of the string.
+	if (!_stream || _error) return;
+	NSRange range = NSMakeRange(0, [string length]);
+	uint8_t *bytes = [_buffer mutableBytes];
+	while (range.length > 0) {
+		NSUInteger used = 0;
+		NSRange remaining = NSMakeRange(0, 0);
+		[string getBytes:bytes + _bufferLength maxLength:kGBFileWriterBufferSize - _bufferLength usedLength:&used encoding:NSUTF8StringEncoding options:0 range:range remainingRange:&remaining];
+		_bufferLength += used;
+		if (remaining.length == range.length) {
+			// Nothing was converted; this happens when the buffer can't hold the next character, so flush it and retry. If the buffer is already empty, the string can't be represented in UTF-8.
+			if (_bufferLength == 0) {
+				_error = [[NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteInapplicableStringEncodingError userInfo:nil] retain];
+				return;
+			}
+			[self flushBuffer];
+			if (_error) return;
+			continue;
+		}
+		range = remaining;
+		if (_bufferLength == kGBFileWriterBufferSize) {
+			[self flushBuffer];
+			if (_error) return;
+		}
+	}
+}
+
+- (BOOL)close:(NSError **)error {
+	if (!_stream) return NO;
+	[self flushBuffer];
+	[_stream close];
+	[_stream release];
+	_stream = nil;
+	if (_error) {
+		if (error) *error = _error;
+		[self discardTemporaryFile];
+		return NO;
+	}
+	
+	if (rename([_temporaryPath fileSystemRepresentation], [_path fileSystemRepresentation]) != 0) {
+		if (error) *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+		[self discardTemporaryFile];
+		return NO;
+	}
+	[_temporaryPath release];
+	_temporaryPath = nil;
+	return YES;
+}
+
+#pragma mark Helper methods
+
+- (void)flushBuffer {
+	GBProfileBegin(writeSample);
+	const uint8_t *bytes = [_buffer bytes];
+	NSUInteger written = 0;
+	while (written < _bufferLength && !_error) {
+		NSInteger result = [_stream write:bytes + written maxLength:_bufferLength - written];
+		if (result <= 0) {
+			_error = [[_stream streamError] retain];
+			if (!_error) _error = [[NSError errorWithDomain:NSPOSIXErrorDomain code:EIO userInfo:nil] retain];
+			break;
+		}
+		written += result;
+	}
+	GBProfileCount(@"writtenBytes", written);
+	GBProfileEnd(writeSample, kGBProfilerPhaseWrite);
+	_bufferLength = 0;
+}
+
+- (void)discardTemporaryFile {
+	if (_stream) {
+		[_stream close];
+		[_stream release];
+		_stream = nil;
+	}
+	[[NSFileManager defaultManager] removeItemAtPath:_temporaryPath error:nil];
+	[_temporaryPath release];
+	_temporaryPath = nil;
+}
+
+#pragma mark Properties
+
+@synthesize path = _path;
+
+@end
@@ -6,30 +6,46 @@
 //  Copyright 2010 Gentle Bytes. All rights reserved.
 //
 
+#import <libkern/OSAtomic.h>
 #import "RegexKitLite.h"
 #import "GBStore.h"
 #import "GBApplicationSettingsProvider.h"
 #import "GBDataObjects.h"
 #import "GBHTMLTemplateVariablesProvider.h"
 #import "GBTemplateHandler.h"
+#import "GBOutputManifest.h"
+#import "GBProfiler.h"
 #import "GBHTMLOutputGenerator.h"
 
+static NSString *kGBHTMLManifestFilename = @".appledoc-html-manifest.plist";
+static NSUInteger kGBHTMLMaximumWriters = 2;
+static NSUInteger kGBHTMLPendingPagesPerWriter = 2;
+
 @interface GBHTMLOutputGenerator ()
 
 - (BOOL)validateTemplates:(NSError **)error;
+- (BOOL)processObjects:(NSError **)error;
+- (BOOL)processObjectsConcurrentlyWithThreads:(NSUInteger)threads error:(NSError **)error;
+- (NSDictionary *)variablesForObject:(id)object withProvider:(GBHTMLTemplateVariablesProvider *)provider;
 - (BOOL)processClasses:(NSError **)error;
 - (BOOL)processCategories:(NSError **)error;
 - (BOOL)processProtocols:(NSError **)error;
 - (BOOL)processIndex:(NSError **)error;
 - (BOOL)processHierarchy:(NSError **)error;
-- (NSString *)stringByCleaningHtml:(NSString *)string;
+- (void)loadManifest;
+- (void)removeStalePagesAndWriteManifest;
+- (BOOL)isPageUpToDateAtPath:(NSString *)path template:(NSString *)suffix variables:(NSDictionary *)vars object:(id)object;
+- (NSString *)manifestPathForPath:(NSString *)path;
 - (NSString *)htmlOutputPathForIndex;
 - (NSString *)htmlOutputPathForHierarchy;
 - (NSString *)htmlOutputPathForObject:(GBModelBase *)object;
 @property (readonly) GBTemplateHandler *htmlObjectTemplate;
 @property (readonly) GBTemplateHandler *htmlIndexTemplate;
 @property (readonly) GBTemplateHandler *htmlHierarchyTemplate;
-@property (readonly) GBHTMLTemplateVariablesProvider *variablesProvider;
+@property (retain) GBHTMLTemplateVariablesProvider *variablesProvider;
+@property (retain) GBOutputManifest *manifest;
+@property (retain) NSMutableDictionary *templateDigests;
+@property (readonly) NSUInteger numberOfThreadsToUse;
 
 @end
 
@@ -42,11 +58,112 @@
 - (BOOL)generateOutputWithStore:(id)store error:(NSError **)error {
 	if (![super generateOutputWithStore:store error:error]) return NO;
 	if (![self validateTemplates:error]) return NO;
+	self.variablesProvider = [GBHTMLTemplateVariablesProvider providerWithSettingsProvider:self.settings];
+	[self loadManifest];
+	if (![self processObjects:error]) return NO;
+	if (![self processIndex:error]) return NO;
+	if (![self processHierarchy:error]) return NO;
+	[self removeStalePagesAndWriteManifest];
+	return YES;
+}
+
+- (BOOL)processObjects:(NSError **)error {
+	NSUInteger count = [self.store.classes count] + [self.store.categories count] + [self.store.protocols count];
+	NSUInteger threads = MIN(self.numberOfThreadsToUse, count);
+	if (threads > 1) return [self processObjectsConcurrentlyWithThreads:threads error:error];
 	if (![self processClasses:error]) return NO;
 	if (![self processCategories:error]) return NO;
 	if (![self processProtocols:error]) return NO;
-	if (![self processIndex:error]) return NO;
-	if (![self processHierarchy:error]) return NO;
+	return YES;
+}
+
+- (BOOL)processObjectsConcurrentlyWithThreads:(NSUInteger)threads error:(NSError **)error {
+	// Object pages are independent, so their variables are prepared by a pool of workers, each taking the next object from the shared list as soon as it's done with the previous one. Prepared pages are passed to a smaller set of serial writer queues, which stream them to files with writeObject:withTemplate:toFile:error:, the same as when generating serially. The semaphore limits the number of pages waiting to be written, so memory usage doesn't depend on the number or size of pages. Each worker uses its own variables provider as the provider keeps state between calls. After the first failure workers stop taking new objects and writers skip pending pages; the error is reported once all workers and writers finish. Exceptions can't propagate out of GCD blocks, so we remember the first one and raise it after all workers and writers finish.
+	NSMutableArray *objects = [NSMutableArray array];
+	[objects addObjectsFromArray:[self.store classesSortedByName]];
+	[objects addObjectsFromArray:[self.store categoriesSortedByName]];
+	[objects addObjectsFromArray:[self.store protocolsSortedByName]];
+	NSUInteger writersCount = MIN(threads, kGBHTMLMaximumWriters);
+	GBLogVerbose(@"Generating %u pages using %u threads and %u writers...", [objects count], threads, writersCount);
+	
+	int32_t count = (int32_t)[objects count];
+	__block int32_t lastIndex = -1;
+	__block volatile BOOL failed = NO;
+	__block NSError *firstError = nil;
+	__block NSException *exception = nil;
+	GBTemplateHandler *template = self.htmlObjectTemplate;
+	dispatch_queue_t *writers = calloc(writersCount, sizeof(dispatch_queue_t));
+	for (NSUInteger i=0; i<writersCount; i++) writers[i] = dispatch_queue_create("com.gentlebytes.appledoc.html.writer", NULL);
+	dispatch_semaphore_t pending = dispatch_semaphore_create(writersCount * kGBHTMLPendingPagesPerWriter);
+	dispatch_group_t writing = dispatch_group_create();
+	dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+	dispatch_apply(threads, queue, ^(size_t worker) {
+		GBHTMLTemplateVariablesProvider *provider = [[GBHTMLTemplateVariablesProvider alloc] initWithSettingsProvider:self.settings];
+		dispatch_queue_t writer = writers[worker % writersCount];
+		int32_t index;
+		while (!failed && (index = OSAtomicIncrement32(&lastIndex)) < count) {
+			NSAutoreleasePool *pool = [[NSAutoreleasePool alloc] init];
+			@try {
+				id object = [objects objectAtIndex:index];
+				GBLogInfo(@"Generating output for %@...", object);
+				NSDictionary *vars = [self variablesForObject:object withProvider:provider];
+				NSString *path = [self htmlOutputPathForObject:object];
+				if ([self isPageUpToDateAtPath:path template:@"object-template.html" variables:vars object:object]) {
+					GBLogDebug(@"Output for %@ is up to date.", object);
+				} else {
+					dispatch_semaphore_wait(pending, DISPATCH_TIME_FOREVER);
+					dispatch_group_async(writing, writer, ^{
+						NSAutoreleasePool *writerPool = [[NSAutoreleasePool alloc] init];
+						@try {
+							NSError *writeError = nil;
+							if (failed) {
+								GBLogDebug(@"Skipping output for %@ after previous failure.", object);
+							} else if (![self writeObject:vars withTemplate:template toFile:[path stringByStandardizingPath] error:&writeError]) {
+								GBLogWarn(@"Failed writting HTML for %@ to '%@'!", object, path);
+								@synchronized(self) {
+									if (!firstError) firstError = [writeError retain];
+								}
+								failed = YES;
+							} else {
+								GBLogDebug(@"Finished generating output for %@.", object);
+							}
+						}
+						@catch (NSException *e) {
+							@synchronized(self) {
+								if (!exception) exception = [e retain];
+							}
+							failed = YES;
+						}
+						[writerPool drain];
+						dispatch_semaphore_signal(pending);
+					});
+				}
+			}
+			@catch (NSException *e) {
+				@synchronized(self) {
+					if (!exception) exception = [e retain];
+				}
+				failed = YES;
+			}
+			[pool drain];
+		}
+		[provider release];
+	});
+	dispatch_group_wait(writing, DISPATCH_TIME_FOREVER);
+	
+	for (NSUInteger i=0; i<writersCount; i++) dispatch_release(writers[i]);
+	free(writers);
+	dispatch_release(writing);
+	dispatch_release(pending);
+	if (exception) {
+		[firstError release];
+		[[exception autorelease] raise];
+	}
+	if (failed) {
+		if (error) *error = [firstError autorelease];
+		else [firstError release];
+		return NO;
+	}
 	return YES;
 }
 
@@ -54,10 +171,12 @@
 	for (GBClassData *class in self.store.classes) {
 		GBLogInfo(@"Generating output for class %@...", class);
 		NSDictionary *vars = [self.variablesProvider variablesForClass:class withStore:self.store];
-		NSString *output = [self.htmlObjectTemplate renderObject:vars];
-		NSString *cleaned = [self stringByCleaningHtml:output];
 		NSString *path = [self htmlOutputPathForObject:class];
-		if (![self writeString:cleaned toFile:[path stringByStandardizingPath] error:error]) {
+		if ([self isPageUpToDateAtPath:path template:@"object-template.html" variables:vars object:class]) {
+			GBLogDebug(@"Output for class %@ is up to date.", class);
+			continue;
+		}
+		if (![self writeObject:vars withTemplate:self.htmlObjectTemplate toFile:[path stringByStandardizingPath] error:error]) {
 			GBLogWarn(@"Failed writting HTML for class %@ to '%@'!", class, path);
 			return NO;
 		}
@@ -70,10 +189,12 @@
 	for (GBCategoryData *category in self.store.categories) {
 		GBLogInfo(@"Generating output for category %@...", category);
 		NSDictionary *vars = [self.variablesProvider variablesForCategory:category withStore:self.store];
-		NSString *output = [self.htmlObjectTemplate renderObject:vars];
-		NSString *cleaned = [self stringByCleaningHtml:output];
 		NSString *path = [self htmlOutputPathForObject:category];
-		if (![self writeString:cleaned toFile:[path stringByStandardizingPath] error:error]) {
+		if ([self isPageUpToDateAtPath:path template:@"object-template.html" variables:vars object:category]) {
+			GBLogDebug(@"Output for category %@ is up to date.", category);
+			continue;
+		}
+		if (![self writeObject:vars withTemplate:self.htmlObjectTemplate toFile:[path stringByStandardizingPath] error:error]) {
 			GBLogWarn(@"Failed writting HTML for category %@ to '%@'!", category, path);
 			return NO;
 		}
@@ -86,10 +207,12 @@
 	for (GBProtocolData *protocol in self.store.protocols) {
 		GBLogInfo(@"Generating output for protocol %@...", protocol);
 		NSDictionary *vars = [self.variablesProvider variablesForProtocol:protocol withStore:self.store];
-		NSString *output = [self.htmlObjectTemplate renderObject:vars];
-		NSString *cleaned = [self stringByCleaningHtml:output];
 		NSString *path = [self htmlOutputPathForObject:protocol];
-		if (![self writeString:cleaned toFile:[path stringByStandardizingPath] error:error]) {
+		if ([self isPageUpToDateAtPath:path template:@"object-template.html" variables:vars object:protocol]) {
+			GBLogDebug(@"Output for protocol %@ is up to date.", protocol);
+			continue;
+		}
+		if (![self writeObject:vars withTemplate:self.htmlObjectTemplate toFile:[path stringByStandardizingPath] error:error]) {
 			GBLogWarn(@"Failed writting HTML for protocol %@ to '%@'!", protocol, path);
 			return NO;
 		}
@@ -102,10 +225,12 @@
 	GBLogInfo(@"Generating output for index...");
 	if ([self.store.classes count] > 0 || [self.store.protocols count] > 0 || [self.store.categories count] > 0) {
 		NSDictionary *vars = [self.variablesProvider variablesForIndexWithStore:self.store];
-		NSString *output = [self.htmlIndexTemplate renderObject:vars];
-		NSString *cleaned = [self stringByCleaningHtml:output];
 		NSString *path = [[self htmlOutputPathForIndex] stringByStandardizingPath];
-		if (![self writeString:cleaned toFile:[path stringByStandardizingPath] error:error]) {
+		if ([self isPageUpToDateAtPath:path template:@"index-template.html" variables:vars object:nil]) {
+			GBLogDebug(@"Output for index is up to date.");
+			return YES;
+		}
+		if (![self writeObject:vars withTemplate:self.htmlIndexTemplate toFile:[path stringByStandardizingPath] error:error]) {
 			GBLogWarn(@"Failed writting HTML index to '%@'!", path);
 			return NO;
 		}
@@ -118,10 +243,12 @@
 	GBLogInfo(@"Generating output for hierarchy...");
 	if ([self.store.classes count] > 0 || [self.store.protocols count] > 0 || [self.store.categories count] > 0) {
 		NSDictionary *vars = [self.variablesProvider variablesForHierarchyWithStore:self.store];
-		NSString *output = [self.htmlHierarchyTemplate renderObject:vars];
-		NSString *cleaned = [self stringByCleaningHtml:output];
 		NSString *path = [[self htmlOutputPathForHierarchy] stringByStandardizingPath];
-		if (![self writeString:cleaned toFile:[path stringByStandardizingPath] error:error]) {
+		if ([self isPageUpToDateAtPath:path template:@"hierarchy-template.html" variables:vars object:nil]) {
+			GBLogDebug(@"Output for hierarchy is up to date.");
+			return YES;
+		}
+		if (![self writeObject:vars withTemplate:self.htmlHierarchyTemplate toFile:[path stringByStandardizingPath] error:error]) {
 			GBLogWarn(@"Failed writting HTML hierarchy to '%@'!", path);
 			return NO;
 		}
@@ -155,13 +282,63 @@
 	return YES;
 }
 
-#pragma mark Helper methods
+#pragma mark Manifest handling
+
+- (void)loadManifest {
+	// Manifest is only used when updating output incrementally. Note that we must load it even if the file doesn't exist, so pages generated in this run are recorded. Static files were already copied from templates at this point, so we can record them right away.
+	self.manifest = nil;
+	self.templateDigests = [NSMutableDictionary dictionary];
+	if (!self.updatesOutputIncrementally) return;
+	self.manifest = [GBOutputManifest manifestWithSettingsProvider:self.settings];
+	[self.manifest loadFromFile:[self.settings.outputPath stringByAppendingPathComponent:kGBHTMLManifestFilename]];
+	for (NSString *path in self.staticFiles) [self.manifest registerFile:path];
+}
+
+- (void)removeStalePagesAndWriteManifest {
+	// Remove all pages and static files handled in previous run that were not handled in this one - these belong to objects or template files that are no longer present. Failures are not considered errors, we only lose some cleanup.
+	if (!self.manifest) return;
+	NSString *outputPath = [self.outputUserPath stringByStandardizingPath];
+	for (NSString *page in self.manifest.stalePages) {
+		NSString *path = [outputPath stringByAppendingPathComponent:page];
+		if (![self.fileManager fileExistsAtPath:path]) continue;
+		GBLogVerbose(@"Removing stale file '%@'...", page);
+		NSError *error = nil;
+		if (![self.fileManager removeItemAtPath:path error:&error]) GBLogNSError(error, @"Failed removing stale file '%@'!", page);
+	}
+	
+	NSError *error = nil;
+	NSString *path = [self.settings.outputPath stringByAppendingPathComponent:kGBHTMLManifestFilename];
+	if (![self.manifest writeToFile:path error:&error]) GBLogNSError(error, @"Failed writting HTML manifest to '%@'!", path);
+}
+
+- (BOOL)isPageUpToDateAtPath:(NSString *)path template:(NSString *)suffix variables:(NSDictionary *)vars object:(id)object {
+	// Page is up to date if it still exists and was generated from the same template and variables in previous run. Template digests are only calculated once per run. Note that this may be called from concurrent workers.
+	if (!self.manifest) return NO;
+	NSString *templateDigest = nil;
+	@synchronized(self.templateDigests) {
+		templateDigest = [self.templateDigests objectForKey:suffix];
+		if (!templateDigest) {
+			NSString *templatePath = [self.templateUserPath stringByAppendingPathComponent:[self templatePathForTemplateEndingWith:suffix]];
+			NSData *data = [NSData dataWithContentsOfFile:[templatePath stringByStandardizingPath]];
+			templateDigest = data ? [self.manifest digestForData:data] : @"";
+			[self.templateDigests setObject:templateDigest forKey:suffix];
+		}
+	}
+	NSString *digest = [self.manifest digestForVariables:vars object:object template:templateDigest];
+	BOOL upToDate = [self.manifest isPage:[self manifestPathForPath:path] upToDateWithDigest:digest];
+	return upToDate && [self.fileManager fileExistsAtPath:[path stringByStandardizingPath]];
+}
 
-- (NSString *)stringByCleaningHtml:(NSString *)string {
-	// Nothing to do at this point - as we're preserving all whitespace, we should be just fine with generated string. The method is still left as a placeholder for possible future handling.
-	return string;
+- (NSString *)manifestPathForPath:(NSString *)path {
+	// Manifest uses paths relative to output path, so output directory can be moved without invalidating it.
+	NSString *outputPath = [[self.outputUserPath stringByStandardizingPath] stringByAppendingString:@"/"];
+	NSString *standardized = [path stringByStandardizingPath];
+	if ([standardized hasPrefix:outputPath]) return [standardized substringFromIndex:[outputPath length]];
+	return standardized;
 }
 
+#pragma mark Helper methods
+
 - (NSString *)htmlOutputPathForIndex {
 	// Returns file name including full path for HTML file representing the main index.
 	NSString *path = [self outputPathToTemplateEndingWith:@"index-template.html"];
@@ -182,13 +359,15 @@
 	return [self.outputUserPath stringByAppendingPathComponent:inner];
 }
 
-- (GBHTMLTemplateVariablesProvider *)variablesProvider {
-	static GBHTMLTemplateVariablesProvider *result = nil;
-	if (!result) {
-		GBLogDebug(@"Initializing variables provider...");
-		result = [[GBHTMLTemplateVariablesProvider alloc] initWithSettingsProvider:self.settings];
-	}
-	return result;
+- (NSDictionary *)variablesForObject:(id)object withProvider:(GBHTMLTemplateVariablesProvider *)provider {
+	if ([object isKindOfClass:[GBClassData class]]) return [provider variablesForClass:object withStore:self.store];
+	if ([object isKindOfClass:[GBCategoryData class]]) return [provider variablesForCategory:object withStore:self.store];
+	return [provider variablesForProtocol:object withStore:self.store];
+}
+
+- (NSUInteger)numberOfThreadsToUse {
+	if (self.settings.numberOfThreads == 0) return [[NSProcessInfo processInfo] activeProcessorCount];
+	return self.settings.numberOfThreads;
 }
 
 - (GBTemplateHandler *)htmlObjectTemplate {
@@ -209,4 +388,14 @@
 	return @"html";
 }
 
+- (BOOL)updatesOutputIncrementally {
+	return self.settings.incrementalHTML;
+}
+
+#pragma mark Properties
+
+@synthesize variablesProvider;
+@synthesize templateDigests;
+@synthesize manifest;
+
 @end
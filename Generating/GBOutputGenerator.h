@@ -10,6 +10,7 @@
 
 @class GBStore;
 @class GBApplicationSettingsProvider;
+@class GBTemplateHandler;
 
 /** The base class for all output generators.
  
@@ -72,6 +73,8 @@
  
  The method uses `[GBApplicationSettingsProvider templatesPath]` as the base path for templates and `[GBApplicationSettingsProvider outputPath]` as the base path for output. In both cases, `outputSubpath` is used to determine the source and destination subdirectories. It then copies all files from template path to the output path, including the whole directory structure. If any special template file is found at source path, it is not copied! Template files are identified by having a `-template` suffix followed by optional extension. For example `object-template.html`. As this message prepares the ground for actual generation, it should be sent before any other messages (i.e. before `generateOutput:`).
  
+ If `updatesOutputIncrementally` is `YES` and output path already exists, it is not removed. Instead only files which are missing at output path or whose contents differ from template path are copied, so unchanged files are left intact.
+ 
  To further aid subclasses, the method reads out all template files in templates path and stores them to `templateFiles` dictionary. Each template file is stored with a key correspoding to it's filename, including the subdirectory within the base template path and extension.
   
  @warning *Note:* This message is intended to be sent from higher-level generator objects. Although it would present no error to run it several times, in most circumstances subclasses don't need to send it manually. If copying fails, a warning is logged and copying is stopped. Depending of type of failure, the method either returns `YES` or `NO`. If copying of all files is succesful, but reading or clearing template or ignored files fails, the operation is still considered succesful, so `YES` is returned. However if replicating the directory structure or copying files fails, this is considered an error and `NO` is returned. In such case, clients should abort further processing.
@@ -113,6 +116,19 @@
  */
 - (BOOL)writeString:(NSString *)string toFile:(NSString *)path error:(NSError **)error;
 
+/** Renders the given object with the given template directly to the given path, creating all necessary directories if they don't exist.
+ 
+ This works similar to rendering the object to string and sending `writeString:toFile:error:`, but the output is streamed to the file as it's rendered, so the whole page is never kept in memory. This is the preferred way of generating large pages from within subclasses.
+ 
+ @param object The object to render, usually template variables dictionary.
+ @param template The template to use for rendering.
+ @param path The path and filename to write to.
+ @param error If writting fails, error description is returned here.
+ @return Returns `YES` is writting succeds, `NO` otherwise.
+ @see writeString:toFile:error:
+ */
+- (BOOL)writeObject:(id)object withTemplate:(GBTemplateHandler *)template toFile:(NSString *)path error:(NSError **)error;
+
 ///---------------------------------------------------------------------------------------
 /// @name Subclass parameters and helpers
 ///---------------------------------------------------------------------------------------
@@ -149,6 +165,17 @@
  */
 @property (readonly) NSMutableDictionary *templateFiles;
 
+/** The array of all static files copied from templates within `copyTemplateFilesToOutputPath:`.
+ 
+ Each object is a file name and relative path from `templateUserPath`, which is also the relative path of the copied file from `outputUserPath`. Template files, ignored files and directories are not included. If output is updated incrementally, unchanged files are also included, although they were not copied again.
+ 
+ This is intended to be used within subclasses only, for example for recording copied files so that files removed from templates can be removed from output.
+ 
+ @see copyTemplateFilesToOutputPath:
+ @see templateFiles
+ */
+@property (readonly) NSArray *staticFiles;
+
 /** Returns user-friendly template path string including `outputSubpath`. 
  
  This uses the same string as entered by the user when starting the application. Send `stringByStandardizingPath` message to the returned value before using it!
@@ -189,6 +216,14 @@
   */
 @property (readonly) NSString *outputSubpath;
 
+/** Specifies whether existing output is preserved and only updated with changes.
+ 
+ If `YES`, `copyTemplateFilesToOutputPath:` doesn't remove existing output path, so subclasses can skip generating unchanged files. Default implementation returns `NO`, subclasses that support incremental updates should override and return proper value.
+ 
+ @see copyTemplateFilesToOutputPath:
+ */
+@property (readonly) BOOL updatesOutputIncrementally;
+
 /** The `GBApplicationSettingsProvider` object that provides application-wide settings for this session. 
  */
 @property (retain) GBApplicationSettingsProvider *settings;
@@ -9,14 +9,17 @@
 #import "GBStore.h"
 #import "GBApplicationSettingsProvider.h"
 #import "GBTemplateHandler.h"
+#import "GBProfiler.h"
 #import "GBOutputGenerator.h"
 
 @interface GBOutputGenerator ()
 
+- (BOOL)updateTemplateFilesFromPath:(NSString *)sourcePath toPath:(NSString *)destPath error:(NSError **)error;
 - (GBTemplateHandler *)templateHandlerFromTemplateFile:(NSString *)filename error:(NSError **)error;
 - (BOOL)isPathRepresentingTemplateFile:(NSString *)path;
 - (BOOL)isPathRepresentingIgnoredFile:(NSString *)path;
 @property (readwrite, retain) GBStore *store;
+@property (readwrite, retain) NSArray *staticFiles;
 
 @end
 
@@ -49,8 +52,9 @@
 }
 
 - (BOOL)copyTemplateFilesToOutputPath:(NSError **)error {
-	// Remove all previous template files.
+	// Remove all previous template and static files.
 	[self.templateFiles removeAllObjects];
+	self.staticFiles = [NSArray array];
 	
 	// Prepare source and destination paths.
 	NSString *sourceUserPath = self.templateUserPath;
@@ -59,6 +63,11 @@
 	NSString *destPath = [destUserPath stringByStandardizingPath];	
 	GBLogVerbose(@"Copying template files from '%@' to '%@'...", sourceUserPath, destUserPath);	
 	
+	// If output is updated incrementally, keep existing output and only update changed files.
+	if (self.updatesOutputIncrementally && [self.fileManager fileExistsAtPath:destPath]) {
+		return [self updateTemplateFilesFromPath:sourcePath toPath:destPath error:error];
+	}
+	
 	// Remove destination path if it exists. Exit if we fail.
 	if ([self.fileManager fileExistsAtPath:destPath]) {
 		GBLogDebug(@"Removing output at '%@'...", destUserPath);
@@ -95,6 +104,7 @@
 		GBLogWarn(@"Failed enumerating template files at '%@'!", destUserPath);
 		return YES;
 	}	
+	NSMutableArray *staticFiles = [NSMutableArray arrayWithCapacity:[items count]];
 	for (NSString *path in items) {
 		BOOL delete = NO;
 		if ([self isPathRepresentingIgnoredFile:path]) {
@@ -108,17 +118,71 @@
 			delete = YES;
 		}
 		
+		NSString *fullpath = [destPath stringByAppendingPathComponent:path];
 		if (delete) {
-			NSString *fullpath = [destPath stringByAppendingPathComponent:path];
 			if (![self.fileManager removeItemAtPath:fullpath error:error]) {
 				GBLogWarn(@"Can't clean leftover '%@' from '%@'.", path, destUserPath);
 			}
+		} else if (![self.fileManager isPathDirectory:fullpath]) {
+			[staticFiles addObject:path];
 		}
 	}
+	self.staticFiles = staticFiles;
 	
 	return YES;
 }
 
+- (BOOL)updateTemplateFilesFromPath:(NSString *)sourcePath toPath:(NSString *)destPath error:(NSError **)error {
+	// Existing output is preserved, so only copy files which are missing or whose contents differ from the template. Template files are still read from source path, while ignored and template files are never copied.
+	GBLogDebug(@"Updating template files at '%@'...", self.outputUserPath);
+	if (![self.fileManager fileExistsAtPath:sourcePath]) {
+		GBLogDebug(@"No template file found at '%@', no need to copy.", self.templateUserPath);
+		return YES;
+	}
+	
+	NSArray *items = [self.fileManager subpathsOfDirectoryAtPath:sourcePath error:error];
+	if (!items) {
+		GBLogWarn(@"Failed enumerating template files at '%@'!", self.templateUserPath);
+		return NO;
+	}
+	NSMutableArray *staticFiles = [NSMutableArray arrayWithCapacity:[items count]];
+	for (NSString *path in items) {
+		if ([self isPathRepresentingIgnoredFile:path]) continue;
+		if ([self isPathRepresentingTemplateFile:path]) {
+			GBTemplateHandler *handler = [self templateHandlerFromTemplateFile:path error:error];
+			if (!handler) return NO;
+			[self.templateFiles setObject:handler forKey:path];
+			continue;
+		}
+		
+		NSString *source = [sourcePath stringByAppendingPathComponent:path];
+		NSString *dest = [destPath stringByAppendingPathComponent:path];
+		BOOL isDirectory = NO;
+		[self.fileManager fileExistsAtPath:source isDirectory:&isDirectory];
+		if (isDirectory) {
+			if (![self.fileManager createDirectoryAtPath:dest withIntermediateDirectories:YES attributes:nil error:error]) {
+				GBLogWarn(@"Failed creating directory '%@'!", dest);
+				return NO;
+			}
+			continue;
+		}
+		
+		[staticFiles addObject:path];
+		if ([self.fileManager contentsEqualAtPath:source andPath:dest]) continue;
+		GBLogDebug(@"Updating template file '%@'...", path);
+		if ([self.fileManager fileExistsAtPath:dest] && ![self.fileManager removeItemAtPath:dest error:error]) {
+			GBLogWarn(@"Failed removing '%@'!", dest);
+			return NO;
+		}
+		if (![self.fileManager copyItemAtPath:source toPath:dest error:error]) {
+			GBLogWarn(@"Failed copying template file '%@' to '%@'!", path, self.outputUserPath);
+			return NO;
+		}
+	}
+	self.staticFiles = staticFiles;
+	return YES;
+}
+
 - (BOOL)initializeDirectoryAtPath:(NSString *)path error:(NSError **)error {
 	return [self initializeDirectoryAtPath:path preserve:nil error:error];
 }
@@ -213,10 +277,30 @@
 		return NO;
 	}
 	
+	GBProfileBegin(writeSample);
 	if (![string writeToFile:standardized atomically:YES encoding:NSUTF8StringEncoding error:error]) {
 		GBLogWarn(@"Failed writting '%@'!", path);
 		return NO;
 	}
+	GBProfileEnd(writeSample, kGBProfilerPhaseWrite);
+	
+	return YES;
+}
+
+- (BOOL)writeObject:(id)object withTemplate:(GBTemplateHandler *)template toFile:(NSString *)path error:(NSError **)error {
+	NSString *standardized = [path stringByStandardizingPath];
+	NSString *directory = [standardized stringByDeletingLastPathComponent];
+	if (![self.fileManager createDirectoryAtPath:directory withIntermediateDirectories:YES attributes:nil error:error]) {
+		GBLogWarn(@"Failed creating directory while writting '%@'!", path);
+		return NO;
+	}
+	
+	GBProfileBegin(renderSample);
+	if (![template renderObject:object toFile:standardized error:error]) {
+		GBLogWarn(@"Failed writting '%@'!", path);
+		return NO;
+	}
+	GBProfileEndObject(renderSample, kGBProfilerPhaseRender, [standardized lastPathComponent]);
 	
 	return YES;
 }
@@ -224,8 +308,8 @@
 - (GBTemplateHandler *)templateHandlerFromTemplateFile:(NSString *)filename error:(NSError **)error {
 	NSString *path = [[self templateUserPath] stringByAppendingPathComponent:filename];
 	GBLogDebug(@"Creating template handler for template file '%@'...", path);
-	GBTemplateHandler *result = [GBTemplateHandler handler];
-	if (![result parseTemplateFromPath:[path stringByStandardizingPath] error:error]) {
+	GBTemplateHandler *result = [GBTemplateHandler handlerWithTemplateFile:path error:error];
+	if (!result) {
 		GBLogWarn(@"Failed parsing template '%@'!", filename);
 		return nil;
 	}
@@ -254,10 +338,15 @@
 	return @"";
 }
 
+- (BOOL)updatesOutputIncrementally {
+	return NO;
+}
+
 #pragma mark Properties
 
 @synthesize previousGenerator;
 @synthesize settings;
 @synthesize store;
+@synthesize staticFiles;
 
 @end
@@ -0,0 +1,121 @@
+//
+//  GBOutputManifest.h
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GBApplicationSettingsProvider;
+
+/** Handles the dependency manifest of generated output pages.
+ 
+ The manifest records a digest for each generated page, keyed by page path relative to the output directory. Digest is calculated from template variables dictionary used for rendering the page and the template itself, so if neither changes between two runs, the page would be rendered exactly the same and can be skipped. The manifest as a whole is tagged with appledoc version and build, so all pages are regenerated after upgrading appledoc.
+ 
+ Output generators use the manifest in the following way: for each page, they send `digestForVariables:object:template:` to get current digest and then `isPage:upToDateWithDigest:` to check if the page needs to be generated. Static files copied to output are recorded with `registerFile:`. After all pages are handled, `stalePages` returns all pages and files handled by previous run which were not handled in current one; these belong to objects or template files that are no longer present and should be removed.
+ */
+@interface GBOutputManifest : NSObject {
+	@private
+	NSDictionary *_pages;
+	NSMutableDictionary *_updatedPages;
+}
+
+///---------------------------------------------------------------------------------------
+/// @name Initialization & disposal
+///---------------------------------------------------------------------------------------
+
+/** Returns autoreleased manifest that works with the given `GBApplicationSettingsProvider` implementor.
+ 
+ @param settingsProvider Application-wide settings provider to use for checking parameters.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given application is `nil`.
+ */
++ (id)manifestWithSettingsProvider:(id)settingsProvider;
+
+/** Initializes the manifest to work with the given `GBApplicationSettingsProvider` implementor.
+ 
+ This is the designated initializer.
+ 
+ @param settingsProvider Application-wide settings provider to use for checking parameters.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given application is `nil`.
+ */
+- (id)initWithSettingsProvider:(id)settingsProvider;
+
+///---------------------------------------------------------------------------------------
+/// @name Persistence handling
+///---------------------------------------------------------------------------------------
+
+/** Loads previous run pages from the given file.
+ 
+ If the file doesn't exist, can't be read or was written by a different appledoc version or build, the manifest starts empty. This is not considered an error; in such case all pages are simply generated.
+ 
+ @param path The path to the manifest file.
+ @see writeToFile:error:
+ */
+- (void)loadFromFile:(NSString *)path;
+
+/** Writes all pages handled during this run to the given file.
+ 
+ @param path The path to the manifest file.
+ @param error If writting fails, error description is returned here.
+ @return Returns `YES` if manifest was written, `NO` otherwise.
+ @see loadFromFile:
+ */
+- (BOOL)writeToFile:(NSString *)path error:(NSError **)error;
+
+///---------------------------------------------------------------------------------------
+/// @name Pages handling
+///---------------------------------------------------------------------------------------
+
+/** Returns the digest of the given template variables.
+ 
+ The digest covers the variables dictionary the page is rendered from: dictionaries, arrays, sets, strings and values are handled directly, while the given object is encoded through the data templates render for it: names, adopted protocols, method sections and methods with their arguments, source infos, html references and processed comments. For all other top-level objects, such as link targets and adopted protocols, only their class and name are used, as their contents are covered by their own pages. So changes to unrelated objects or to data not used by templates don't affect the digest.
+ 
+ @param vars The template variables dictionary used for rendering the page.
+ @param object The top-level object for which the page is generated or `nil` for pages not representing single object.
+ @param template The digest of the template used for rendering the page.
+ @return Returns digest string.
+ @exception NSException Thrown if the given variables or template is `nil`.
+ @see digestForData:
+ */
+- (NSString *)digestForVariables:(NSDictionary *)vars object:(id)object template:(NSString *)template;
+
+/** Returns the digest of the given data.
+ 
+ This is useful for getting the digest of a template file.
+ 
+ @param data The data to digest.
+ @return Returns digest string.
+ @see digestForVariables:object:template:
+ */
+- (NSString *)digestForData:(NSData *)data;
+
+/** Registers the page at the given path with the given digest and returns whether previous run generated the page with the same digest.
+ 
+ Note that the method only compares digests; it's up to the caller to verify that the page still exists.
+ 
+ @param path The path to the page, relative to output directory.
+ @param digest Current digest of the page.
+ @return Returns `YES` if previous run generated the page from the same digest, `NO` otherwise.
+ @exception NSException Thrown if any of the parameters is `nil`.
+ @see stalePages
+ */
+- (BOOL)isPage:(NSString *)path upToDateWithDigest:(NSString *)digest;
+
+/** Registers the file at the given path as part of current run output.
+ 
+ This is used for files copied to output instead of generated, such as static files from templates. Such files are not compared with previous run, they are only recorded, so that `stalePages` returns them once they are no longer copied.
+ 
+ @param path The path to the file, relative to output directory.
+ @exception NSException Thrown if the given path is `nil`.
+ @see stalePages
+ */
+- (void)registerFile:(NSString *)path;
+
+/** Returns the array of relative paths of all pages and files handled by previous run, which were not registered during current run. */
+@property (readonly) NSArray *stalePages;
+
+@end
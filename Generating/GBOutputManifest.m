@@ -0,0 +1,324 @@
+//
+//  GBOutputManifest.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <CommonCrypto/CommonDigest.h>
+#import "GBApplicationSettingsProvider.h"
+#import "GBDataObjects.h"
+#import "GBOutputManifest.h"
+
+static NSString *kGBManifestVersionKey = @"version";
+static NSString *kGBManifestPagesKey = @"pages";
+
+@interface GBOutputManifest ()
+
+- (void)appendValue:(id)value toString:(NSMutableString *)string rootObject:(id)root;
+- (void)appendMethodsProvider:(GBMethodsProvider *)provider toString:(NSMutableString *)string;
+- (void)appendMethod:(GBMethodData *)method toString:(NSMutableString *)string;
+- (void)appendCommonDataOfObject:(GBModelBase *)object toString:(NSMutableString *)string;
+- (void)appendComment:(GBComment *)comment toString:(NSMutableString *)string;
+- (void)appendParagraphs:(NSArray *)paragraphs toString:(NSMutableString *)string;
+- (void)appendParagraph:(GBCommentParagraph *)paragraph toString:(NSMutableString *)string;
+- (void)appendParagraphItems:(NSArray *)items toString:(NSMutableString *)string;
+@property (readonly) NSString *manifestVersion;
+@property (retain) GBApplicationSettingsProvider *settings;
+
+@end
+
+#pragma mark -
+
+@implementation GBOutputManifest
+
+#pragma mark Initialization & disposal
+
++ (id)manifestWithSettingsProvider:(id)settingsProvider {
+	return [[[self alloc] initWithSettingsProvider:settingsProvider] autorelease];
+}
+
+- (id)initWithSettingsProvider:(id)settingsProvider {
+	NSParameterAssert(settingsProvider != nil);
+	GBLogDebug(@"Initializing output manifest with settings provider %@...", settingsProvider);
+	self = [super init];
+	if (self) {
+		self.settings = settingsProvider;
+		_pages = [[NSDictionary alloc] init];
+		_updatedPages = [[NSMutableDictionary alloc] init];
+	}
+	return self;
+}
+
+#pragma mark Persistence handling
+
+- (void)loadFromFile:(NSString *)path {
+	GBLogVerbose(@"Loading output manifest from '%@'...", path);
+	NSString *standardized = [path stringByStandardizingPath];
+	NSDictionary *pages = nil;
+	NSData *data = [NSData dataWithContentsOfFile:standardized];
+	if (data) {
+		NSError *error = nil;
+		NSDictionary *manifest = [NSPropertyListSerialization propertyListWithData:data options:NSPropertyListImmutable format:NULL error:&error];
+		if (!manifest) {
+			GBLogWarn(@"Failed reading output manifest from '%@', ignoring it!", path);
+		} else if (![[manifest objectForKey:kGBManifestVersionKey] isEqualToString:self.manifestVersion]) {
+			GBLogVerbose(@"Output manifest was created by different appledoc version, ignoring it.");
+		} else {
+			pages = [manifest objectForKey:kGBManifestPagesKey];
+		}
+	}
+	@synchronized(self) {
+		[_pages release];
+		_pages = pages ? [pages retain] : [[NSDictionary alloc] init];
+		[_updatedPages removeAllObjects];
+	}
+}
+
+- (BOOL)writeToFile:(NSString *)path error:(NSError **)error {
+	GBLogVerbose(@"Writting output manifest to '%@'...", path);
+	NSData *data = nil;
+	@synchronized(self) {
+		NSMutableDictionary *manifest = [NSMutableDictionary dictionaryWithCapacity:2];
+		[manifest setObject:self.manifestVersion forKey:kGBManifestVersionKey];
+		[manifest setObject:_updatedPages forKey:kGBManifestPagesKey];
+		data = [NSPropertyListSerialization dataWithPropertyList:manifest format:NSPropertyListBinaryFormat_v1_0 options:0 error:error];
+	}
+	if (!data) return NO;
+	
+	NSString *standardized = [path stringByStandardizingPath];
+	NSString *directory = [standardized stringByDeletingLastPathComponent];
+	if (![[NSFileManager defaultManager] createDirectoryAtPath:directory withIntermediateDirectories:YES attributes:nil error:error]) return NO;
+	return [data writeToFile:standardized options:NSDataWritingAtomic error:error];
+}
+
+#pragma mark Pages handling
+
+- (NSString *)digestForVariables:(NSDictionary *)vars object:(id)object template:(NSString *)template {
+	NSParameterAssert(vars != nil);
+	NSParameterAssert(template != nil);
+	NSMutableString *string = [NSMutableString stringWithCapacity:4096];
+	[self appendValue:template toString:string rootObject:object];
+	[self appendValue:vars toString:string rootObject:object];
+	return [self digestForData:[string dataUsingEncoding:NSUTF8StringEncoding]];
+}
+
+- (NSString *)digestForData:(NSData *)data {
+	unsigned char digest[CC_SHA1_DIGEST_LENGTH];
+	CC_SHA1([data bytes], (CC_LONG)[data length], digest);
+	NSMutableString *result = [NSMutableString stringWithCapacity:CC_SHA1_DIGEST_LENGTH * 2];
+	for (NSUInteger i=0; i<CC_SHA1_DIGEST_LENGTH; i++) [result appendFormat:@"%02x", digest[i]];
+	return result;
+}
+
+- (BOOL)isPage:(NSString *)path upToDateWithDigest:(NSString *)digest {
+	NSParameterAssert(path != nil);
+	NSParameterAssert(digest != nil);
+	@synchronized(self) {
+		[_updatedPages setObject:digest forKey:path];
+		return [[_pages objectForKey:path] isEqualToString:digest];
+	}
+}
+
+- (void)registerFile:(NSString *)path {
+	NSParameterAssert(path != nil);
+	@synchronized(self) {
+		[_updatedPages setObject:@"" forKey:path];
+	}
+}
+
+- (NSArray *)stalePages {
+	NSMutableArray *result = [NSMutableArray array];
+	@synchronized(self) {
+		for (NSString *path in _pages) {
+			if (![_updatedPages objectForKey:path]) [result addObject:path];
+		}
+	}
+	return [result sortedArrayUsingSelector:@selector(compare:)];
+}
+
+#pragma mark Digest handling
+
+- (void)appendValue:(id)value toString:(NSMutableString *)string rootObject:(id)root {
+	// Values are encoded explicitly by type. Strings are prefixed with their length so that concatenated values can't produce the same result. Collections are handled recursively; dictionaries and sets are sorted as their enumeration order is not defined. Model objects are encoded through the data templates render for them. Other top-level objects only affect output through their names; their contents are covered by their own pages. Any other object, such as GRMustache booleans, is only encoded by its class.
+	if (!value || value == [NSNull null]) {
+		[string appendString:@"~"];
+	} else if ([value isKindOfClass:[NSString class]]) {
+		[string appendFormat:@"s%lu:%@", [value length], value];
+	} else if ([value isKindOfClass:[NSValue class]] || [value isKindOfClass:[NSDate class]]) {
+		[string appendFormat:@"v%@;", value];
+	} else if ([value isKindOfClass:[NSDictionary class]]) {
+		[string appendString:@"{"];
+		NSArray *keys = [[value allKeys] sortedArrayUsingSelector:@selector(compare:)];
+		for (id key in keys) {
+			[self appendValue:key toString:string rootObject:root];
+			[self appendValue:[value objectForKey:key] toString:string rootObject:root];
+		}
+		[string appendString:@"}"];
+	} else if ([value isKindOfClass:[NSArray class]]) {
+		[string appendString:@"["];
+		for (id item in value) [self appendValue:item toString:string rootObject:root];
+		[string appendString:@"]"];
+	} else if ([value isKindOfClass:[NSSet class]]) {
+		NSMutableArray *items = [NSMutableArray arrayWithCapacity:[value count]];
+		for (id item in value) {
+			NSMutableString *itemString = [NSMutableString string];
+			[self appendValue:item toString:itemString rootObject:root];
+			[items addObject:itemString];
+		}
+		[string appendFormat:@"(%@)", [[items sortedArrayUsingSelector:@selector(compare:)] componentsJoinedByString:@""]];
+	} else if ([value isKindOfClass:[GBModelBase class]] && [value isTopLevelObject] && value != root) {
+		[string appendFormat:@"@%@:%@;", NSStringFromClass([value class]), value];
+	} else if ([value isKindOfClass:[GBClassData class]]) {
+		GBClassData *class = value;
+		[string appendString:@"<class"];
+		[self appendValue:[NSArray arrayWithObjects:class.nameOfClass, class.nameOfSuperclass ? class.nameOfSuperclass : @"", nil] toString:string rootObject:root];
+		[self appendValue:class.adoptedProtocols.protocols toString:string rootObject:root];
+		[self appendMethodsProvider:class.methods toString:string];
+		[self appendCommonDataOfObject:class toString:string];
+		[string appendString:@">"];
+	} else if ([value isKindOfClass:[GBCategoryData class]]) {
+		GBCategoryData *category = value;
+		[string appendString:@"<category"];
+		[self appendValue:category.idOfCategory toString:string rootObject:root];
+		[self appendValue:category.adoptedProtocols.protocols toString:string rootObject:root];
+		[self appendMethodsProvider:category.methods toString:string];
+		[self appendCommonDataOfObject:category toString:string];
+		[string appendString:@">"];
+	} else if ([value isKindOfClass:[GBProtocolData class]]) {
+		GBProtocolData *protocol = value;
+		[string appendString:@"<protocol"];
+		[self appendValue:protocol.nameOfProtocol toString:string rootObject:root];
+		[self appendValue:protocol.adoptedProtocols.protocols toString:string rootObject:root];
+		[self appendMethodsProvider:protocol.methods toString:string];
+		[self appendCommonDataOfObject:protocol toString:string];
+		[string appendString:@">"];
+	} else if ([value isKindOfClass:[GBApplicationStringsProvider class]]) {
+		GBApplicationStringsProvider *strings = value;
+		[string appendString:@"<strings"];
+		[self appendValue:strings.objectPage toString:string rootObject:root];
+		[self appendValue:strings.objectSpecifications toString:string rootObject:root];
+		[self appendValue:strings.objectOverview toString:string rootObject:root];
+		[self appendValue:strings.objectTasks toString:string rootObject:root];
+		[self appendValue:strings.objectMethods toString:string rootObject:root];
+		[self appendValue:strings.indexPage toString:string rootObject:root];
+		[self appendValue:strings.hierarchyPage toString:string rootObject:root];
+		[self appendValue:strings.appledocData toString:string rootObject:root];
+		[string appendString:@">"];
+	} else {
+		[string appendFormat:@"<%@>", NSStringFromClass([value class])];
+	}
+}
+
+- (void)appendMethodsProvider:(GBMethodsProvider *)provider toString:(NSMutableString *)string {
+	[string appendString:@"["];
+	for (GBMethodSectionData *section in provider.sections) {
+		[self appendValue:section.sectionName toString:string rootObject:nil];
+		[string appendString:@"["];
+		for (GBMethodData *method in section.methods) [self appendMethod:method toString:string];
+		[string appendString:@"]"];
+	}
+	[string appendString:@"]"];
+}
+
+- (void)appendMethod:(GBMethodData *)method toString:(NSMutableString *)string {
+	[string appendFormat:@"<method%lu,%d", method.methodType, method.isRequired];
+	[self appendValue:method.methodAttributes toString:string rootObject:nil];
+	[self appendValue:method.methodResultTypes toString:string rootObject:nil];
+	for (GBMethodArgument *argument in method.methodArguments) {
+		[self appendValue:argument.argumentName toString:string rootObject:nil];
+		[self appendValue:argument.argumentTypes toString:string rootObject:nil];
+		[self appendValue:argument.argumentVar toString:string rootObject:nil];
+		[self appendValue:argument.isVariableArg ? argument.terminationMacros : nil toString:string rootObject:nil];
+	}
+	[self appendCommonDataOfObject:method toString:string];
+	[string appendString:@">"];
+}
+
+- (void)appendCommonDataOfObject:(GBModelBase *)object toString:(NSMutableString *)string {
+	// Html references are assigned by the processor, so they are handled as any other data.
+	[self appendValue:object.htmlReferenceName toString:string rootObject:nil];
+	[self appendValue:object.htmlLocalReference toString:string rootObject:nil];
+	for (GBSourceInfo *info in [object sourceInfosSortedByName]) [string appendFormat:@"i%lu:%@:%lu;", [info.filename length], info.filename, info.lineNumber];
+	[self appendComment:object.comment toString:string];
+}
+
+- (void)appendComment:(GBComment *)comment toString:(NSMutableString *)string {
+	if (!comment) {
+		[string appendString:@"~"];
+		return;
+	}
+	[string appendString:@"<comment"];
+	[self appendValue:comment.stringValue toString:string rootObject:nil];
+	[self appendParagraphs:comment.paragraphs toString:string];
+	[self appendParagraphs:comment.descriptionParagraphs toString:string];
+	for (NSArray *arguments in [NSArray arrayWithObjects:comment.parameters, comment.exceptions, nil]) {
+		[string appendString:@"["];
+		for (GBCommentArgument *argument in arguments) {
+			[self appendValue:argument.argumentName toString:string rootObject:nil];
+			[self appendParagraph:argument.argumentDescription toString:string];
+		}
+		[string appendString:@"]"];
+	}
+	[self appendParagraph:comment.result toString:string];
+	[self appendParagraphItems:comment.crossrefs toString:string];
+	[string appendString:@">"];
+}
+
+- (void)appendParagraphs:(NSArray *)paragraphs toString:(NSMutableString *)string {
+	[string appendString:@"["];
+	for (GBCommentParagraph *paragraph in paragraphs) [self appendParagraph:paragraph toString:string];
+	[string appendString:@"]"];
+}
+
+- (void)appendParagraph:(GBCommentParagraph *)paragraph toString:(NSMutableString *)string {
+	if (!paragraph) {
+		[string appendString:@"~"];
+		return;
+	}
+	[self appendParagraphItems:paragraph.paragraphItems toString:string];
+}
+
+- (void)appendParagraphItems:(NSArray *)items toString:(NSMutableString *)string {
+	// Each item is encoded with its class and string value, followed by the data specific to the item type. Link targets are only encoded by their names, as their contents are covered by their own pages.
+	[string appendString:@"["];
+	for (GBParagraphItem *item in items) {
+		[string appendFormat:@"<%@", NSStringFromClass([item class])];
+		[self appendValue:item.stringValue toString:string rootObject:nil];
+		if ([item isKindOfClass:[GBParagraphLinkItem class]]) {
+			GBParagraphLinkItem *link = (GBParagraphLinkItem *)item;
+			[string appendFormat:@"%d", link.isLocal];
+			[self appendValue:link.href toString:string rootObject:nil];
+			[self appendValue:[link.context description] toString:string rootObject:nil];
+			[self appendValue:[link.member description] toString:string rootObject:nil];
+		} else if ([item isKindOfClass:[GBParagraphListItem class]]) {
+			GBParagraphListItem *list = (GBParagraphListItem *)item;
+			[string appendFormat:@"%d", list.isOrdered];
+			[self appendParagraphs:list.listItems toString:string];
+		} else if ([item isKindOfClass:[GBParagraphSpecialItem class]]) {
+			GBParagraphSpecialItem *special = (GBParagraphSpecialItem *)item;
+			[string appendFormat:@"%lu", special.specialItemType];
+			[self appendParagraph:special.specialItemDescription toString:string];
+		} else if ([item isKindOfClass:[GBParagraphDecoratorItem class]]) {
+			GBParagraphDecoratorItem *decorator = (GBParagraphDecoratorItem *)item;
+			[string appendFormat:@"%lu", decorator.decorationType];
+			[self appendParagraphItems:decorator.decoratedItems toString:string];
+		}
+		[string appendString:@">"];
+	}
+	[string appendString:@"]"];
+}
+
+#pragma mark Helper methods
+
+- (NSString *)manifestVersion {
+	NSDictionary *appledocData = self.settings.stringTemplates.appledocData;
+	return [NSString stringWithFormat:@"%@-%@", [appledocData objectForKey:@"version"], [appledocData objectForKey:@"build"]];
+}
+
+#pragma mark Properties
+
+@synthesize settings;
+
+@end
@@ -30,6 +30,19 @@
 /** Returns a new autoreleased `GBTemplateHandler`. */
 + (id)handler;
 
+/** Returns a shared `GBTemplateHandler` with the template parsed from the given file.
+ 
+ Parsed templates are cached for the lifetime of the process, keyed by standardized path and validated by the digest of file contents. As long as contents don't change, all requests for the same path return the same instance without compiling the template again; once contents change, the file is parsed again on the next request, regardless of its modification date. This way each template is compiled only once regardless of how many output generators or generation runs use it.
+ 
+ @warning *Important:* As returned instances are shared, they should only be used for rendering; sending them any of the parsing messages would affect all other users!
+ 
+ @param path The path of the template file to parse.
+ @param error If reading or parsing fails, error message is returned here.
+ @return Returns parsed template handler or `nil` if reading or parsing failed.
+ @see parseTemplateFromPath:error:
+ */
++ (id)handlerWithTemplateFile:(NSString *)path error:(NSError **)error;
+
 ///---------------------------------------------------------------------------------------
 /// @name Parsing
 ///---------------------------------------------------------------------------------------
@@ -72,7 +85,20 @@
  @return Returns generated output string.
  @see parseTemplateFromPath:error:
  @see parseTemplate:error:
+ @see renderObject:toFile:error:
  */
 - (NSString *)renderObject:(id)object;
 
+/** Renders the given object using current template data directly to the given file.
+ 
+ This works the same as `renderObject:`, except that rendered output is written to the file as it is produced, through a bounded buffer, instead of being composed into a string first. This keeps memory usage independent of the size of the rendered output. The file is replaced atomically, so if rendering or writting fails, previous file is left intact. The directory of the given path must already exist.
+ 
+ @param object The object containins data to be replaced by template placeholders.
+ @param path The path to the file to write.
+ @param error If writting fails, error description is returned here.
+ @return Returns `YES` if the file was written, `NO` otherwise.
+ @see renderObject:
+ */
+- (BOOL)renderObject:(id)object toFile:(NSString *)path error:(NSError **)error;
+
 @end
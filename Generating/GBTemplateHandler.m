@@ -6,22 +6,30 @@
 //  Copyright (c) 2010 __MyCompanyName__. All rights reserved.
 //
 
+#import <CommonCrypto/CommonDigest.h>
 #import "RegexKitLite.h"
 #import "GRMustache.h"
 #import "GBDictionaryTemplateLoader.h"
+#import "GBLineIndex.h"
+#import "GBFileWriter.h"
 #import "GBTemplateHandler.h"
 
 static NSString *kGBSectionKey = @"section";
 static NSString *kGBNameKey = @"name";
 static NSString *kGBValueKey = @"value";
+static NSString *kGBDigestKey = @"digest";
+static NSString *kGBHandlerKey = @"handler";
 
 #pragma mark -
 
 @interface GBTemplateHandler ()
 
++ (NSString *)digestFromData:(NSData *)data;
 - (void)clearParsedValues;
-- (BOOL)validateSectionData:(NSDictionary *)data withTemplate:(NSString *)template;
-- (NSUInteger)lineOfSectionData:(NSDictionary *)data withinTemplate:(NSString *)template;
+- (BOOL)validateSectionData:(NSDictionary *)data atLine:(NSUInteger)line;
+- (NSUInteger)lineOfSectionAtOffset:(NSUInteger)offset withinTemplate:(NSString *)template;
+- (void)appendChunk:(NSString *)chunk toString:(NSMutableString *)string;
+@property (retain) GBLineIndex *templateLineIndex;
 
 @end
 
@@ -35,6 +43,38 @@ static NSString *kGBValueKey = @"value";
 	return [[[self alloc] init] autorelease];
 }
 
++ (id)handlerWithTemplateFile:(NSString *)path error:(NSError **)error {
+	// Entries are validated by contents digest rather than modification date, as the file may change within date resolution or be replaced by a copy with preserved date. Reading the file is cheap compared to compiling it.
+	static NSMutableDictionary *handlers = nil;
+	NSString *key = [path stringByStandardizingPath];
+	NSData *data = [NSData dataWithContentsOfFile:key];
+	NSString *digest = data ? [self digestFromData:data] : nil;
+	@synchronized(self) {
+		if (!handlers) handlers = [[NSMutableDictionary alloc] init];
+		NSDictionary *entry = [handlers objectForKey:key];
+		if (digest && [[entry objectForKey:kGBDigestKey] isEqualToString:digest]) {
+			GBLogDebug(@"Using compiled template '%@'...", path);
+			return [entry objectForKey:kGBHandlerKey];
+		}
+		
+		GBTemplateHandler *result = [self handler];
+		if (![result parseTemplateFromPath:key error:error]) {
+			[handlers removeObjectForKey:key];
+			return nil;
+		}
+		if (digest) [handlers setObject:[NSDictionary dictionaryWithObjectsAndKeys:digest, kGBDigestKey, result, kGBHandlerKey, nil] forKey:key];
+		return result;
+	}
+}
+
++ (NSString *)digestFromData:(NSData *)data {
+	unsigned char digest[CC_SHA1_DIGEST_LENGTH];
+	CC_SHA1([data bytes], (CC_LONG)[data length], digest);
+	NSMutableString *result = [NSMutableString stringWithCapacity:CC_SHA1_DIGEST_LENGTH * 2];
+	for (NSUInteger i=0; i<CC_SHA1_DIGEST_LENGTH; i++) [result appendFormat:@"%02x", digest[i]];
+	return result;
+}
+
 - (id)init {
 	self = [super init];
 	if (self) {
@@ -59,34 +99,32 @@ static NSString *kGBValueKey = @"value";
 - (BOOL)parseTemplate:(NSString *)template error:(NSError **)error {
 	[self clearParsedValues];
 	if ([template length] == 0) return YES;
+	
+	// Scan the template for sections in a single pass. Text between sections is collected into clean string: each chunk is trimmed and non-empty chunks are delimited by a new line.
 	NSString *regex = @"(Section\\s+(\\w+)\\s+(.*?)\\s+EndSection)";
-	NSString *clean = [template copy];
-	while (YES) {
-		// Get all components of the regex.
-		NSRange searchRange = NSMakeRange(0, [clean length]);
-		NSDictionary *sectionData = [clean dictionaryByMatchingRegex:regex options:RKLDotAll range:searchRange error:nil withKeysAndCaptures:kGBSectionKey, 1, kGBNameKey, 2, kGBValueKey, 3, nil];
-		if ([sectionData count] == 0) break;
-
-		// If section data is valid, use it.
-		if ([self validateSectionData:sectionData withTemplate:template]) {
+	NSMutableString *clean = [NSMutableString stringWithCapacity:[template length]];
+	NSUInteger location = 0;
+	while (location < [template length]) {
+		NSRange searchRange = NSMakeRange(location, [template length] - location);
+		NSRange sectionRange = [template rangeOfRegex:regex options:RKLDotAll inRange:searchRange capture:0 error:nil];
+		if (sectionRange.location == NSNotFound) break;
+		
+		// Get all components of the section; if section data is valid, use it.
+		NSDictionary *sectionData = [template dictionaryByMatchingRegex:regex options:RKLDotAll range:sectionRange error:nil withKeysAndCaptures:kGBSectionKey, 1, kGBNameKey, 2, kGBValueKey, 3, nil];
+		NSUInteger line = [self lineOfSectionAtOffset:sectionRange.location withinTemplate:template];
+		if ([self validateSectionData:sectionData atLine:line]) {
 			NSString *name = [sectionData objectForKey:kGBNameKey];
 			NSString *value = [[sectionData objectForKey:kGBValueKey] stringByTrimmingWhitespaceAndNewLine];
 			[_templateSections setObject:value forKey:name];
 		}
-		
-		// If the section is valid, log it.
-		NSUInteger line = [self lineOfSectionData:sectionData withinTemplate:template];
 		GBLogDebug(@"Found section template %@ at line %ld...", [sectionData objectForKey:kGBNameKey], line);
-
-		// Get the range of the regex within the clean string and remove the substring from it.
-		NSString *section = [sectionData objectForKey:kGBSectionKey];
-		NSRange range = [clean rangeOfString:section];
-		NSString *prefix = [[clean substringToIndex:range.location] stringByTrimmingWhitespaceAndNewLine];
-		NSString *suffix = [[clean substringFromIndex:range.location + range.length] stringByTrimmingWhitespaceAndNewLine];
-		NSString *delimiter = ([prefix length] > 0 && [suffix length] > 0) ? @"\n" : @"";
-		clean = [NSString stringWithFormat:@"%@%@%@", prefix, delimiter, suffix];
-		if ([clean length] == 0) break;
+		
+		// Append the text preceeding the section to clean string.
+		[self appendChunk:[template substringWithRange:NSMakeRange(location, sectionRange.location - location)] toString:clean];
+		location = sectionRange.location + sectionRange.length;
 	}
+	if (location == 0) [clean setString:template];
+	else [self appendChunk:[template substringFromIndex:location] toString:clean];
 	
 	// Prepare template string and warn if it's empty.
 	if ([clean length] == 0) GBLogWarn(@"Template contains empty string (with %ld template sections)!", [_templateSections count]);
@@ -112,19 +150,28 @@ static NSString *kGBValueKey = @"value";
 	return [_template renderObject:object];
 }
 
+- (BOOL)renderObject:(id)object toFile:(NSString *)path error:(NSError **)error {
+	GBLogVerbose(@"Rendering %@ to '%@'...", [[object description] normalizedDescription], path);
+	GBFileWriter *writer = [GBFileWriter writerWithPath:path];
+	if (![writer open:error]) return NO;
+	if (_template)
+		[_template renderObject:object toOutput:writer];
+	else
+		GBLogWarn(@"No template loaded or parsed, ignoring redering!");
+	return [writer close:error];
+}
+
 #pragma mark Helper methods
 
-- (BOOL)validateSectionData:(NSDictionary *)data withTemplate:(NSString *)template {
+- (BOOL)validateSectionData:(NSDictionary *)data atLine:(NSUInteger)line {
 	NSString *name = [data objectForKey:kGBNameKey];
 	if ([name length] == 0) {
-		NSUInteger line = [self lineOfSectionData:data withinTemplate:template];
 		GBLogWarn(@"Unnamed section found at line %ld, ignoring!", line);
 		return NO;
 	}
 
 	NSString *value = [[data objectForKey:kGBValueKey] stringByTrimmingWhitespace];
 	if ([value length] == 0) {
-		NSUInteger line = [self lineOfSectionData:data withinTemplate:template];
 		GBLogWarn(@"Empty section %@ found at line %ld, ignoring!", name, line);
 		return NO;
 	}
@@ -132,10 +179,16 @@ static NSString *kGBValueKey = @"value";
 	return YES;
 }
 
-- (NSUInteger)lineOfSectionData:(NSDictionary *)data withinTemplate:(NSString *)template {
-	NSString *section = [data objectForKey:kGBSectionKey];
-	NSRange range = [template rangeOfString:section];
-	return [template numberOfLinesInRange:NSMakeRange(0, range.location)];
+- (NSUInteger)lineOfSectionAtOffset:(NSUInteger)offset withinTemplate:(NSString *)template {
+	if (self.templateLineIndex.string != template) self.templateLineIndex = [GBLineIndex indexWithString:template];
+	return [self.templateLineIndex lineNumberAtOffset:offset];
+}
+
+- (void)appendChunk:(NSString *)chunk toString:(NSMutableString *)string {
+	NSString *trimmed = [chunk stringByTrimmingWhitespaceAndNewLine];
+	if ([trimmed length] == 0) return;
+	if ([string length] > 0) [string appendString:@"\n"];
+	[string appendString:trimmed];
 }
 
 - (void)clearParsedValues {
@@ -143,6 +196,11 @@ static NSString *kGBValueKey = @"value";
 	_template = nil;
 	_templateString = @"";
 	[_templateSections removeAllObjects];
+	self.templateLineIndex = nil;
 }
 
+#pragma mark Properties
+
+@synthesize templateLineIndex;
+
 @end
@@ -18,6 +18,7 @@
 	@private
 	NSString *_categoryName;
 	NSString *_className;
+	NSString *_categoryID;
 	GBAdoptedProtocolsProvider *_adoptedProtocols;
 	GBMethodsProvider *_methods;
 }
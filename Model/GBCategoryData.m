@@ -7,6 +7,7 @@
 //
 
 #import "GBDataObjects.h"
+#import "GBSymbol.h"
 #import "GBCategoryData.h"
 
 @implementation GBCategoryData
@@ -22,8 +23,9 @@
 	GBLogDebug(@"Initializing %@%@ for class %@...", name ? @"category " : @"extension", name ? name : @"", className);
 	self = [super init];
 	if (self) {
-		_categoryName = name ? [name copy] : nil;
-		_className = [className copy];
+		_categoryName = [[GBSymbol symbolWithString:name] retain];
+		_className = [[GBSymbol symbolWithString:className] retain];
+		_categoryID = [[GBSymbol symbolWithString:[NSString stringWithFormat:@"%@(%@)", className, name ? name : @""]] retain];
 		_adoptedProtocols = [[GBAdoptedProtocolsProvider alloc] initWithParentObject:self];
 		_methods = [[GBMethodsProvider alloc] initWithParentObject:self];
 	}
@@ -63,13 +65,9 @@
 	return ([self nameOfCategory] == nil);
 }
 
-- (NSString *)idOfCategory {
-	if (self.isExtension) return [NSString stringWithFormat:@"%@()", self.nameOfClass];
-	return [NSString stringWithFormat:@"%@(%@)", self.nameOfClass, self.nameOfCategory];
-}
-
 @synthesize nameOfCategory = _categoryName;
 @synthesize nameOfClass = _className;
+@synthesize idOfCategory = _categoryID;
 @synthesize adoptedProtocols = _adoptedProtocols;
 @synthesize methods = _methods;
 
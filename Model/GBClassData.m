@@ -7,6 +7,7 @@
 //
 
 #import "GBDataObjects.h"
+#import "GBSymbol.h"
 #import "GBClassData.h"
 
 @implementation GBClassData
@@ -22,7 +23,7 @@
 	GBLogDebug(@"Initializing class with name %@...", name);
 	self = [super init];
 	if (self) {
-		_className = [name copy];
+		_className = [[GBSymbol symbolWithString:name] retain];
 		_adoptedProtocols = [[GBAdoptedProtocolsProvider alloc] initWithParentObject:self];
 		_ivars = [[GBIvarsProvider alloc] initWithParentObject:self];
 		_methods = [[GBMethodsProvider alloc] initWithParentObject:self];
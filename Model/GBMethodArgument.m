@@ -6,6 +6,7 @@
 //  Copyright (C) 2010, Gentle Bytes. All rights reserved.
 //
 
+#import "GBSymbol.h"
 #import "GBMethodArgument.h"
 
 @implementation GBMethodArgument
@@ -29,10 +30,10 @@
 	NSParameterAssert(([types count] == 0 && var == nil) || ([types count] > 0 && var != nil));
 	self = [super init];
 	if (self) {
-		_argumentName = [name copy];
-		_argumentTypes = [types retain];
-		_argumentVar = [var copy];
-		_terminationMacros = macros ? [macros retain] : [[NSArray alloc] init];
+		_argumentName = [[GBSymbol symbolWithString:name] retain];
+		_argumentTypes = [[GBSymbol symbolsWithStrings:types] retain];
+		_argumentVar = [[GBSymbol symbolWithString:var] retain];
+		_terminationMacros = macros ? [[GBSymbol symbolsWithStrings:macros] retain] : [[NSArray alloc] init];
 		self.isVariableArg = (macros != nil);
 	}
 	return self;
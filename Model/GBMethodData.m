@@ -8,6 +8,7 @@
 
 #import "GRMustache.h"
 #import "GBMethodArgument.h"
+#import "GBSymbol.h"
 #import "GBMethodData.h"
 
 @interface GBMethodData ()
@@ -44,11 +45,11 @@
 	self = [super init];
 	if (self) {
 		_methodType = type;
-		_methodAttributes = [attributes retain];
-		_methodResultTypes = [result retain];
+		_methodAttributes = [[GBSymbol symbolsWithStrings:attributes] retain];
+		_methodResultTypes = [[GBSymbol symbolsWithStrings:result] retain];
 		_methodArguments = [arguments retain];
 		_methodSelectorDelimiter = [[self selectorDelimiterFromAssignedData] retain];
-		_methodSelector = [[self selectorFromAssignedData] retain];
+		_methodSelector = [[GBSymbol symbolWithString:[self selectorFromAssignedData]] retain];
 		_methodPrefix = [[self prefixFromAssignedData] retain];
 	}
 	return self;
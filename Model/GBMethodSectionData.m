@@ -19,11 +19,10 @@
 }
 
 - (BOOL)unregisterMethod:(GBMethodData *)method {
-	if ([_methods containsObject:method]) {
-		[_methods removeObject:method];
-		return YES;
-	}
-	return NO;
+	NSUInteger index = [_methods indexOfObjectIdenticalTo:method];
+	if (index == NSNotFound) return NO;
+	[_methods removeObjectAtIndex:index];
+	return YES;
 }
 
 #pragma mark Overiden methods
@@ -26,6 +26,9 @@
 	NSMutableArray *_properties;
 	NSMutableDictionary *_methodsBySelectors;
 	NSMutableDictionary *_sectionsByNames;
+	NSMutableSet *_registeredMethods;
+	NSMapTable *_sectionsByMethods;
+	BOOL _methodsNeedCompacting;
 	GBMethodSectionData *_registeringSection;
 	id _parent;
 }
@@ -130,6 +133,8 @@
 
 /** The array of all registered methods as `GBMethodData` instances in the order of registration.
  
+ Unregistered methods are removed from the array lazily, the first time it's requested after `unregisterMethod:`, so that removing many methods remains linear.
+ 
  @see classMethods
  @see instanceMethods
  @see properties
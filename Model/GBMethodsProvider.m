@@ -13,6 +13,9 @@
 @interface GBMethodsProvider ()
 
 - (void)addMethod:(GBMethodData *)method toSortedArray:(NSMutableArray *)array;
+- (void)removeMethod:(GBMethodData *)method fromSortedArray:(NSMutableArray *)array;
+- (NSMutableArray *)sortedArrayForMethod:(GBMethodData *)method;
+- (void)compactMethods;
 
 @end
 
@@ -28,13 +31,6 @@
 	self = [super init];
 	if (self) {
 		_parent = [parent retain];
-		_sections = [[NSMutableArray alloc] init];
-		_methods = [[NSMutableArray alloc] init];
-		_classMethods = [[NSMutableArray alloc] init];
-		_instanceMethods = [[NSMutableArray alloc] init];
-		_properties = [[NSMutableArray alloc] init];
-		_methodsBySelectors = [[NSMutableDictionary alloc] init];
-		_sectionsByNames = [[NSMutableDictionary alloc] init];
 	}
 	return self;
 }
@@ -46,6 +42,10 @@
 	GBMethodSectionData *section = [[[GBMethodSectionData alloc] init] autorelease];
 	section.sectionName = name;
 	_registeringSection = section;
+	if (!_sections) {
+		_sections = [[NSMutableArray alloc] init];
+		_sectionsByNames = [[NSMutableDictionary alloc] init];
+	}
 	[_sections addObject:section];
 	if (name) [_sectionsByNames setObject:section forKey:name];
 	return section;
@@ -74,7 +74,7 @@
 	// Note that we allow adding several methods with the same selector as long as the type is different (i.e. class and instance methods). In such case, methodBySelector will preffer instance method or property to class method! Note that this could be implemented more inteligently by prefixing selectors with some char or similar and then handling that within methodBySelector: and prefer instance/property in there. However at the time being current code seems sufficient and simpler, so let's stick with it for a while...
 	NSParameterAssert(method != nil);
 	GBLogDebug(@"%@: Registering method %@...", _parent, method);
-	if ([_methods containsObject:method]) return;
+	if ([_registeredMethods containsObject:method]) return;
 	GBMethodData *existingMethod = [_methodsBySelectors objectForKey:method.methodSelector];
 	if (existingMethod && existingMethod.methodType == method.methodType) {
 		[existingMethod mergeDataFromObject:method];
@@ -82,51 +82,84 @@
 	}
 	
 	method.parentObject = _parent;
-	[_methods addObject:method];	
+	if (!_methods) {
+		// Many objects (most categories and protocols for example) never get any method, so collections are only created with the first one.
+		_methods = [[NSMutableArray alloc] init];
+		_classMethods = [[NSMutableArray alloc] init];
+		_instanceMethods = [[NSMutableArray alloc] init];
+		_properties = [[NSMutableArray alloc] init];
+		_methodsBySelectors = [[NSMutableDictionary alloc] init];
+		_registeredMethods = [[NSMutableSet alloc] init];
+		_sectionsByMethods = [[NSMapTable mapTableWithStrongToStrongObjects] retain];
+	}
+	[self compactMethods];
+	[_methods addObject:method];
+	[_registeredMethods addObject:method];
 	if ([self.sections count] == 0) _registeringSection = [self registerSectionWithName:nil];
 	if (!_registeringSection) _registeringSection = [self.sections lastObject];
 	[_registeringSection registerMethod:method];
-	
-	switch (method.methodType) {
-		case GBMethodTypeClass:
-			[self addMethod:method toSortedArray:_classMethods];
-			break;
-		case GBMethodTypeInstance:
-			[self addMethod:method toSortedArray:_instanceMethods];
-			break;
-		case GBMethodTypeProperty:
-			[self addMethod:method toSortedArray:_properties];
-			break;
-	}
+	[_sectionsByMethods setObject:_registeringSection forKey:method];
+	[self addMethod:method toSortedArray:[self sortedArrayForMethod:method]];
 	
 	if (existingMethod && existingMethod.methodType != GBMethodTypeClass) return;
 	[_methodsBySelectors setObject:method forKey:method.methodSelector];
 }
 
 - (void)unregisterMethod:(GBMethodData *)method {
-	// Remove from all our lists.
-	[_methods removeObject:method];
-	[_classMethods removeObject:method];
-	[_instanceMethods removeObject:method];
-	[_properties removeObject:method];
+	// Sorted arrays use binary search and we remember the section of each method, so we only need to search the section itself. Methods array is in registration order, so we just mark it for compacting.
+	if (![_registeredMethods containsObject:method]) return;
+	[_registeredMethods removeObject:method];
+	[self removeMethod:method fromSortedArray:[self sortedArrayForMethod:method]];
+	_methodsNeedCompacting = YES;
 	
-	// Ask all sections to remove the method from their lists.
-	[_sections enumerateObjectsUsingBlock:^(GBMethodSectionData *section, NSUInteger idx, BOOL *stop) {
-		if ([section unregisterMethod:method]) {
-			if ([section.methods count] == 0) {
-				[_sections removeObject:section];
-				if (section.sectionName) [_sectionsByNames removeObjectForKey:section.sectionName];
-			}
-			*stop = YES;
-		}
-	}];
+	GBMethodSectionData *section = [_sectionsByMethods objectForKey:method];
+	[_sectionsByMethods removeObjectForKey:method];
+	if ([section unregisterMethod:method] && [section.methods count] == 0) {
+		[_sections removeObjectIdenticalTo:section];
+		if (section.sectionName) [_sectionsByNames removeObjectForKey:section.sectionName];
+	}
 }
 
 - (void)addMethod:(GBMethodData *)method toSortedArray:(NSMutableArray *)array {
-	[array addObject:method];
-	[array sortUsingComparator:^(GBMethodData *obj1, GBMethodData *obj2) {
+	// Methods with equal selectors are kept in the order of registration, the same as stable sorting after appending would.
+	NSUInteger index = [array indexOfObject:method inSortedRange:NSMakeRange(0, [array count]) options:NSBinarySearchingInsertionIndex | NSBinarySearchingLastEqual usingComparator:^(GBMethodData *obj1, GBMethodData *obj2) {
 		return [obj1.methodSelector compare:obj2.methodSelector];
 	}];
+	[array insertObject:method atIndex:index];
+}
+
+- (void)removeMethod:(GBMethodData *)method fromSortedArray:(NSMutableArray *)array {
+	NSUInteger count = [array count];
+	NSUInteger index = [array indexOfObject:method inSortedRange:NSMakeRange(0, count) options:NSBinarySearchingFirstEqual usingComparator:^(GBMethodData *obj1, GBMethodData *obj2) {
+		return [obj1.methodSelector compare:obj2.methodSelector];
+	}];
+	if (index == NSNotFound) return;
+	for (; index < count; index++) {
+		GBMethodData *existing = [array objectAtIndex:index];
+		if (existing == method) {
+			[array removeObjectAtIndex:index];
+			return;
+		}
+		if (![existing.methodSelector isEqualToString:method.methodSelector]) return;
+	}
+}
+
+- (NSMutableArray *)sortedArrayForMethod:(GBMethodData *)method {
+	switch (method.methodType) {
+		case GBMethodTypeClass: return _classMethods;
+		case GBMethodTypeInstance: return _instanceMethods;
+		case GBMethodTypeProperty: return _properties;
+	}
+	return nil;
+}
+
+- (void)compactMethods {
+	if (!_methodsNeedCompacting) return;
+	NSIndexSet *indexes = [_methods indexesOfObjectsPassingTest:^(GBMethodData *method, NSUInteger idx, BOOL *stop) {
+		return (BOOL)![_registeredMethods containsObject:method];
+	}];
+	[_methods removeObjectsAtIndexes:indexes];
+	_methodsNeedCompacting = NO;
 }
 
 #pragma mark Output generation helpers
@@ -198,10 +231,26 @@
 
 #pragma mark Properties
 
-@synthesize methods = _methods;
-@synthesize classMethods = _classMethods;
-@synthesize instanceMethods = _instanceMethods;
-@synthesize properties = _properties;
-@synthesize sections = _sections;
+- (NSArray *)methods {
+	if (!_methods) return [NSArray array];
+	[self compactMethods];
+	return _methods;
+}
+
+- (NSArray *)classMethods {
+	return _classMethods ? _classMethods : [NSArray array];
+}
+
+- (NSArray *)instanceMethods {
+	return _instanceMethods ? _instanceMethods : [NSArray array];
+}
+
+- (NSArray *)properties {
+	return _properties ? _properties : [NSArray array];
+}
+
+- (NSArray *)sections {
+	return _sections ? _sections : [NSArray array];
+}
 
 @end
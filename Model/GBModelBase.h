@@ -14,6 +14,7 @@
 /** Provides common functionality for model objects. */
 @interface GBModelBase : NSObject {
 	@private
+	GBSourceInfo *_sourceInfo;
 	NSMutableSet *_sourceInfos;
 	NSMutableDictionary *_sourceInfosByFilenames;
 }
@@ -10,18 +10,16 @@
 #import "GBSourceInfo.h"
 #import "GBModelBase.h"
 
-@implementation GBModelBase
+@interface GBModelBase ()
 
-#pragma mark Initialization & disposal
+- (GBSourceInfo *)sourceInfoWithFilename:(NSString *)filename;
+- (void)addSourceInfo:(GBSourceInfo *)data replacingSourceInfo:(GBSourceInfo *)existing;
 
-- (id)init {
-	self = [super init];
-	if (self) {
-		_sourceInfos = [[NSMutableSet alloc] init];
-		_sourceInfosByFilenames = [[NSMutableDictionary alloc] init];
-	}
-	return self;
-}
+@end
+
+#pragma mark -
+
+@implementation GBModelBase
 
 #pragma mark Merging handling
 
@@ -31,17 +29,12 @@
 	// Merge declared files.
 	NSArray *sourceFiles = [[source sourceInfos] allObjects];
 	for (GBSourceInfo *filedata in sourceFiles) {
-		GBSourceInfo *ourfiledata = [_sourceInfosByFilenames objectForKey:filedata.filename];
+		GBSourceInfo *ourfiledata = [self sourceInfoWithFilename:filedata.filename];
 		if (ourfiledata) {
-			if (ourfiledata.lineNumber < filedata.lineNumber) {
-				[_sourceInfosByFilenames setObject:filedata forKey:filedata.filename];
-				[_sourceInfos removeObject:ourfiledata];
-				[_sourceInfos addObject:filedata];
-			}
+			if (ourfiledata.lineNumber < filedata.lineNumber) [self addSourceInfo:filedata replacingSourceInfo:ourfiledata];
 			continue;
 		}
-		[_sourceInfosByFilenames setObject:filedata forKey:filedata.filename];
-		[_sourceInfos addObject:filedata];
+		[self addSourceInfo:filedata replacingSourceInfo:nil];
 	}
 	
 	// Merge comment.
@@ -59,13 +52,33 @@
 	NSParameterAssert(data != nil);
 	
 	// Ignore already registered objects.
-	if ([_sourceInfos member:data]) return;
+	if (data == _sourceInfo || [_sourceInfos member:data]) return;
 	
-	// Replace data with same filename.
-	GBSourceInfo *existing = [_sourceInfosByFilenames objectForKey:data.filename];
+	// Add object, replacing data with same filename.
+	GBSourceInfo *existing = [self sourceInfoWithFilename:data.filename];
+	[self addSourceInfo:data replacingSourceInfo:existing];
+}
+
+- (GBSourceInfo *)sourceInfoWithFilename:(NSString *)filename {
+	if (_sourceInfosByFilenames) return [_sourceInfosByFilenames objectForKey:filename];
+	if ([_sourceInfo.filename isEqualToString:filename]) return _sourceInfo;
+	return nil;
+}
+
+- (void)addSourceInfo:(GBSourceInfo *)data replacingSourceInfo:(GBSourceInfo *)existing {
+	// Most objects are declared in a single file, so we keep the first source info inline and only create collections once a second file is registered.
+	if (!_sourceInfosByFilenames) {
+		if (!_sourceInfo || _sourceInfo == existing) {
+			[_sourceInfo release];
+			_sourceInfo = [data retain];
+			return;
+		}
+		_sourceInfos = [[NSMutableSet alloc] initWithObjects:_sourceInfo, nil];
+		_sourceInfosByFilenames = [[NSMutableDictionary alloc] initWithObjectsAndKeys:_sourceInfo, _sourceInfo.filename, nil];
+		[_sourceInfo release];
+		_sourceInfo = nil;
+	}
 	if (existing) [_sourceInfos removeObject:existing];
-	
-	// Add object.
 	[_sourceInfosByFilenames setObject:data forKey:data.filename];
 	[_sourceInfos addObject:data];
 }
@@ -94,8 +107,13 @@
 
 #pragma mark Properties
 
+- (NSSet *)sourceInfos {
+	if (_sourceInfos) return _sourceInfos;
+	if (_sourceInfo) return [NSSet setWithObject:_sourceInfo];
+	return [NSSet set];
+}
+
 @synthesize comment;
-@synthesize sourceInfos = _sourceInfos;
 @synthesize parentObject;
 @synthesize htmlLocalReference;
 @synthesize htmlReferenceName;
@@ -7,6 +7,7 @@
 //
 
 #import "GBDataObjects.h"
+#import "GBSymbol.h"
 #import "GBProtocolData.h"
 
 @implementation GBProtocolData
@@ -22,7 +23,7 @@
 	GBLogDebug(@"Initializing protocol with name %@...", name);
 	self = [super init];
 	if (self) {
-		_protocolName = [name copy];
+		_protocolName = [[GBSymbol symbolWithString:name] retain];
 		_adoptedProtocols = [[GBAdoptedProtocolsProvider alloc] initWithParentObject:self];
 		_methods = [[GBMethodsProvider alloc] initWithParentObject:self];
 	}
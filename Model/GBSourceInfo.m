@@ -6,6 +6,7 @@
 //  Copyright (C) 2010, Gentle Bytes. All rights reserved.
 //
 
+#import "GBSymbol.h"
 #import "GBSourceInfo.h"
 
 @interface GBSourceInfo ()
@@ -25,7 +26,7 @@
 	NSParameterAssert(filename != nil);
 	NSParameterAssert([filename length] > 0);
 	GBSourceInfo *result = [[[GBSourceInfo alloc] init] autorelease];
-	result.filename = filename;
+	result.filename = [GBSymbol symbolWithString:filename];
 	result.lineNumber = lineNumber;
 	return result;
 }
@@ -89,6 +89,18 @@
  */
 - (void)unregisterTopLevelObject:(id)object;
 
+/** Registers all classes, categories and protocols from the given store.
+ 
+ Each object from the source store is registered using the same rules as `registerClass:`, `registerCategory:` or `registerProtocol:`, so objects with the same name are merged to existing ones. This allows parsing different files to separate stores and then combining them into a single store. Objects are registered in the order of their names so that the result doesn't depend on the way source store keeps its objects.
+ 
+ @param store The store from which to register objects.
+ @exception NSException Thrown if the given store is `nil`.
+ @see registerClass:
+ @see registerCategory:
+ @see registerProtocol:
+ */
+- (void)registerObjectsFromStore:(GBStore *)store;
+
 ///---------------------------------------------------------------------------------------
 /// @name Data handling
 ///---------------------------------------------------------------------------------------
@@ -70,7 +70,7 @@
 	NSParameterAssert(category != nil);
 	GBLogDebug(@"Registering category %@...", category);
 	if ([_categories containsObject:category]) return;
-	NSString *categoryID = [NSString stringWithFormat:@"%@(%@)", category.nameOfClass, category.nameOfCategory ? category.nameOfCategory : @""];
+	NSString *categoryID = category.idOfCategory;
 	GBCategoryData *existingCategory = [_categoriesByName objectForKey:categoryID];
 	if (existingCategory) {
 		[existingCategory mergeDataFromObject:category];
@@ -93,6 +93,15 @@
 	[_protocolsByName setObject:protocol forKey:protocol.nameOfProtocol];
 }
 
+- (void)registerObjectsFromStore:(GBStore *)store {
+	NSParameterAssert(store != nil);
+	GBLogDebug(@"Registering objects from %@...", store);
+	if (store == self) return;
+	for (GBClassData *class in [store classesSortedByName]) [self registerClass:class];
+	for (GBCategoryData *category in [store categoriesSortedByName]) [self registerCategory:category];
+	for (GBProtocolData *protocol in [store protocolsSortedByName]) [self registerProtocol:protocol];
+}
+
 - (void)unregisterTopLevelObject:(id)object {
 	if ([_classes containsObject:object]) {
 		[_classes removeObject:object];
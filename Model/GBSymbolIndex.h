@@ -0,0 +1,123 @@
+//
+//  GBSymbolIndex.h
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GBStore;
+@class GBClassData;
+@class GBCategoryData;
+@class GBProtocolData;
+@class GBMethodData;
+
+/** Provides fast resolution of names and relations of objects registered to a `GBStore`.
+ 
+ The index is built once for a store, after superclass links and adopted protocols of all objects are set up. It maps names to top-level objects and precomputes, for each object, its chain of known superclasses and the closure of all protocols it conforms to, directly, through adopted protocols or through its superclasses. This allows resolving relations that would otherwise require walking object graphs or searching all registered objects each time.
+ 
+ The index doesn't observe the store; if an object is removed from the store after the index is built, send `removeObject:` to the index as well. Relations are never changed after the index is built, so the index can be queried from multiple threads concurrently, as long as no objects are removed at the same time. The only exception are relations of objects that weren't registered to the store when the index was built; these are computed and cached on first request.
+ */
+@interface GBSymbolIndex : NSObject {
+	@private
+	GBStore *_store;
+	NSMutableDictionary *_objectsByName;
+	NSMutableDictionary *_classesByName;
+	NSMutableDictionary *_categoriesByName;
+	NSMutableDictionary *_protocolsByName;
+	NSMapTable *_superclassesByObject;
+	NSMapTable *_protocolsByObject;
+}
+
+///---------------------------------------------------------------------------------------
+/// @name Initialization & disposal
+///---------------------------------------------------------------------------------------
+
+/** Returns autoreleased index of all objects registered to the given store.
+ 
+ @param store The store to index.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given store is `nil`.
+ */
++ (id)indexWithStore:(GBStore *)store;
+
+/** Initializes the index of all objects registered to the given store.
+ 
+ This is the designated initializer.
+ 
+ @param store The store to index.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given store is `nil`.
+ */
+- (id)initWithStore:(GBStore *)store;
+
+///---------------------------------------------------------------------------------------
+/// @name Objects handling
+///---------------------------------------------------------------------------------------
+
+/** Returns the top-level object with the given name.
+ 
+ If a class, category and protocol share the same name, class is preferred to category and category to protocol.
+ 
+ @param name The name of the class, ID of the category or name of the protocol.
+ @return Returns the object or `nil` if no object is found.
+ @see classWithName:
+ @see categoryWithName:
+ @see protocolWithName:
+ */
+- (id)objectWithName:(NSString *)name;
+
+/** Returns the class with the given name or `nil` if no such class is known. */
+- (GBClassData *)classWithName:(NSString *)name;
+
+/** Returns the category with the given ID or `nil` if no such category is known. */
+- (GBCategoryData *)categoryWithName:(NSString *)name;
+
+/** Returns the protocol with the given name or `nil` if no such protocol is known. */
+- (GBProtocolData *)protocolWithName:(NSString *)name;
+
+/** Removes the given top-level object from name mappings.
+ 
+ Relations of other objects to the removed object are preserved, so documentation can still be found in superclasses or protocols that were removed from the store.
+ 
+ @param object The object to remove.
+ */
+- (void)removeObject:(id)object;
+
+///---------------------------------------------------------------------------------------
+/// @name Relations handling
+///---------------------------------------------------------------------------------------
+
+/** Returns the array of known superclasses of the given class, starting with the direct superclass.
+ 
+ @param class The class for which to return superclasses.
+ @return Returns the array of `GBClassData`, empty if the class has no known superclass.
+ */
+- (NSArray *)superclassesOfClass:(GBClassData *)class;
+
+/** Returns the array of all protocols the given object conforms to.
+ 
+ Directly adopted protocols are listed first, followed by protocols adopted by them, and then protocols of superclasses in the same order. Each protocol is listed only once.
+ 
+ @param object The class, category or protocol for which to return protocols.
+ @return Returns the array of `GBProtocolData`, empty if the object conforms to no protocol.
+ */
+- (NSArray *)protocolsOfObject:(id)object;
+
+/** Returns the first method with the given selector that is commented, searching superclasses and then protocols of the given object.
+ 
+ Superclasses are searched in the order of `superclassesOfClass:`, protocols in the order of `protocolsOfObject:`. The object itself is not searched. Methods whose comment has empty string value are not considered commented.
+ 
+ @param selector The selector of the method.
+ @param object The class, category or protocol whose superclasses and protocols to search.
+ @param source If not `NULL`, the superclass or protocol declaring the method is returned here.
+ @return Returns the method or `nil` if no commented method is found.
+ */
+- (GBMethodData *)documentedMethodWithSelector:(NSString *)selector inheritedByObject:(id)object source:(id *)source;
+
+/** The store this index was built from. */
+@property (readonly) GBStore *store;
+
+@end
@@ -0,0 +1,187 @@
+//
+//  GBSymbolIndex.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBStore.h"
+#import "GBDataObjects.h"
+#import "GBSymbolIndex.h"
+
+@interface GBSymbolIndex ()
+
+- (void)registerObject:(id)object withName:(NSString *)name toDictionary:(NSMutableDictionary *)dictionary;
+- (NSArray *)superclassesClosureOfClass:(GBClassData *)class;
+- (NSArray *)protocolsClosureOfObject:(id)object;
+
+@end
+
+#pragma mark -
+
+@implementation GBSymbolIndex
+
+#pragma mark Initialization & disposal
+
++ (id)indexWithStore:(GBStore *)store {
+	return [[[self alloc] initWithStore:store] autorelease];
+}
+
+- (id)initWithStore:(GBStore *)store {
+	// Names are registered in order of preference, so that the first object with the given name wins. Closures are computed for all objects up front; computing them memoizes closures of superclasses and protocols, so each object is handled only once.
+	NSParameterAssert(store != nil);
+	GBLogDebug(@"Initializing symbol index for %@...", store);
+	self = [super init];
+	if (self) {
+		_store = [store retain];
+		_objectsByName = [[NSMutableDictionary alloc] init];
+		_classesByName = [[NSMutableDictionary alloc] init];
+		_categoriesByName = [[NSMutableDictionary alloc] init];
+		_protocolsByName = [[NSMutableDictionary alloc] init];
+		_superclassesByObject = [[NSMapTable mapTableWithStrongToStrongObjects] retain];
+		_protocolsByObject = [[NSMapTable mapTableWithStrongToStrongObjects] retain];
+		for (GBClassData *class in [store classesSortedByName]) [self registerObject:class withName:class.nameOfClass toDictionary:_classesByName];
+		for (GBCategoryData *category in [store categoriesSortedByName]) [self registerObject:category withName:category.idOfCategory toDictionary:_categoriesByName];
+		for (GBProtocolData *protocol in [store protocolsSortedByName]) [self registerObject:protocol withName:protocol.nameOfProtocol toDictionary:_protocolsByName];
+		for (GBClassData *class in store.classes) [self superclassesOfClass:class];
+		for (GBClassData *class in store.classes) [self protocolsOfObject:class];
+		for (GBCategoryData *category in store.categories) [self protocolsOfObject:category];
+		for (GBProtocolData *protocol in store.protocols) [self protocolsOfObject:protocol];
+	}
+	return self;
+}
+
+- (void)registerObject:(id)object withName:(NSString *)name toDictionary:(NSMutableDictionary *)dictionary {
+	if (!name) return;
+	[dictionary setObject:object forKey:name];
+	if (![_objectsByName objectForKey:name]) [_objectsByName setObject:object forKey:name];
+}
+
+#pragma mark Objects handling
+
+- (id)objectWithName:(NSString *)name {
+	if (!name) return nil;
+	return [_objectsByName objectForKey:name];
+}
+
+- (GBClassData *)classWithName:(NSString *)name {
+	if (!name) return nil;
+	return [_classesByName objectForKey:name];
+}
+
+- (GBCategoryData *)categoryWithName:(NSString *)name {
+	if (!name) return nil;
+	return [_categoriesByName objectForKey:name];
+}
+
+- (GBProtocolData *)protocolWithName:(NSString *)name {
+	if (!name) return nil;
+	return [_protocolsByName objectForKey:name];
+}
+
+- (void)removeObject:(id)object {
+	// Another object may have the same name in the combined dictionary (for example NSObject class and protocol), so we need to re-register the remaining one.
+	NSString *name = nil;
+	if ([object isKindOfClass:[GBClassData class]]) {
+		name = [object nameOfClass];
+		if ([_classesByName objectForKey:name] == object) [_classesByName removeObjectForKey:name];
+	} else if ([object isKindOfClass:[GBCategoryData class]]) {
+		name = [object idOfCategory];
+		if ([_categoriesByName objectForKey:name] == object) [_categoriesByName removeObjectForKey:name];
+	} else if ([object isKindOfClass:[GBProtocolData class]]) {
+		name = [object nameOfProtocol];
+		if ([_protocolsByName objectForKey:name] == object) [_protocolsByName removeObjectForKey:name];
+	}
+	if (!name || [_objectsByName objectForKey:name] != object) return;
+	id replacement = [_classesByName objectForKey:name];
+	if (!replacement) replacement = [_categoriesByName objectForKey:name];
+	if (!replacement) replacement = [_protocolsByName objectForKey:name];
+	if (replacement)
+		[_objectsByName setObject:replacement forKey:name];
+	else
+		[_objectsByName removeObjectForKey:name];
+}
+
+#pragma mark Relations handling
+
+- (NSArray *)superclassesOfClass:(GBClassData *)class {
+	NSArray *result = [_superclassesByObject objectForKey:class];
+	if (!result) result = [self superclassesClosureOfClass:class];
+	return result;
+}
+
+- (NSArray *)protocolsOfObject:(id)object {
+	NSArray *result = [_protocolsByObject objectForKey:object];
+	if (!result) result = [self protocolsClosureOfObject:object];
+	return result;
+}
+
+- (GBMethodData *)documentedMethodWithSelector:(NSString *)selector inheritedByObject:(id)object source:(id *)source {
+	if ([object isKindOfClass:[GBClassData class]]) {
+		for (GBClassData *class in [self superclassesOfClass:object]) {
+			GBMethodData *method = [class.methods methodBySelector:selector];
+			if ([method.comment.stringValue length] > 0) {
+				if (source) *source = class;
+				return method;
+			}
+		}
+	}
+	for (GBProtocolData *protocol in [self protocolsOfObject:object]) {
+		GBMethodData *method = [protocol.methods methodBySelector:selector];
+		if ([method.comment.stringValue length] > 0) {
+			if (source) *source = protocol;
+			return method;
+		}
+	}
+	return nil;
+}
+
+- (NSArray *)superclassesClosureOfClass:(GBClassData *)class {
+	// Cyclic hierarchies are invalid, but may still appear in sources; we stop at the first class that repeats.
+	NSMutableArray *result = [NSMutableArray array];
+	NSMutableSet *visited = [NSMutableSet setWithObject:class];
+	GBClassData *superclass = class.superclass;
+	while (superclass && ![visited containsObject:superclass]) {
+		[result addObject:superclass];
+		[visited addObject:superclass];
+		superclass = superclass.superclass;
+	}
+	[_superclassesByObject setObject:result forKey:class];
+	return result;
+}
+
+- (NSArray *)protocolsClosureOfObject:(id)object {
+	// Placeholder is stored before computing, so cycles in protocol adoption end with the placeholder. For classes, protocols of the superclass, which already include protocols of its superclasses, are appended after the object's own protocols.
+	NSMutableArray *result = [NSMutableArray array];
+	[_protocolsByObject setObject:result forKey:object];
+	NSMutableSet *visited = [NSMutableSet setWithObject:object];
+	NSArray *adopted = [[object adoptedProtocols] protocolsSortedByName];
+	for (GBProtocolData *protocol in adopted) {
+		if ([visited containsObject:protocol]) continue;
+		[result addObject:protocol];
+		[visited addObject:protocol];
+	}
+	for (GBProtocolData *protocol in adopted) {
+		for (GBProtocolData *inherited in [self protocolsOfObject:protocol]) {
+			if ([visited containsObject:inherited]) continue;
+			[result addObject:inherited];
+			[visited addObject:inherited];
+		}
+	}
+	GBClassData *superclass = [object isKindOfClass:[GBClassData class]] ? [object superclass] : nil;
+	if (superclass) {
+		for (GBProtocolData *inherited in [self protocolsOfObject:superclass]) {
+			if ([visited containsObject:inherited]) continue;
+			[result addObject:inherited];
+			[visited addObject:inherited];
+		}
+	}
+	return result;
+}
+
+#pragma mark Properties
+
+@synthesize store = _store;
+
+@end
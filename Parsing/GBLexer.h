@@ -0,0 +1,156 @@
+//
+//  GBLexer.h
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "ParseKit.h"
+
+/** Describes a single token found by `GBLexer`.
+
+ Records don't contain any objects; the token is described by its ParseKit token type and the range of bytes within UTF-8 input data. The line is 1 based and is determined the same way `GBLineIndex` does.
+ */
+typedef struct {
+	PKTokenType type;
+	NSUInteger offset;
+	NSUInteger length;
+	NSUInteger line;
+} GBLexerRecord;
+
+/** Splits Objective-C source code into tokens without creating objects for each token.
+
+ This is a purpose built replacement for ParseKit's `PKTokenizer` as set up by `GBObjectiveCParser`. The whole input is scanned once when the lexer is initialized and each token is stored as a flat `GBLexerRecord` referring to the original UTF-8 bytes. Strings and `PKToken` instances are only created when the client asks for them with `stringForRecordAtIndex:` or `tokenAtIndex:`; the latter are cached, so the same token object is returned for the same index.
+
+ Token types and boundaries follow `PKTokenizer` with default states, words starting with `_` and `...` as a single symbol, so the rest of the parser sees the same token stream regardless of which tokenizer is used. This includes reporting Objective-C keywords such as `@interface` as single tokens (ParseKit reports them as twitter handles). URLs and e-mail addresses outside comments and strings are not recognized, they are split into words and symbols. Whitespace and ordinary C comments are skipped, only appledoc comments (starting with `///` or `/**`) are reported as comment tokens. Unlike ParseKit, which works on unicode characters, the lexer works on bytes; any non-ASCII character is treated as part of a word and quoted strings may contain backslash escaped quotes.
+
+ Token offsets are byte offsets within UTF-8 input, so they are only equal to `PKToken` offsets for ASCII input. Use `[GBLexerToken line]` instead of converting offsets to line numbers.
+ */
+@interface GBLexer : NSObject {
+	@private
+	NSData *_data;
+	NSMutableData *_records;
+	NSUInteger _numberOfTokens;
+	NSPointerArray *_tokens;
+}
+
+///---------------------------------------------------------------------------------------
+/// @name Initialization & disposal
+///---------------------------------------------------------------------------------------
+
+/** Returns autoreleased lexer that tokenizes the given string.
+
+ @param string The string to tokenize.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given string is `nil`.
+ */
++ (id)lexerWithString:(NSString *)string;
+
+/** Returns autoreleased lexer that tokenizes the given UTF-8 data.
+
+ @param data UTF-8 encoded data to tokenize.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given data is `nil`.
+ */
++ (id)lexerWithData:(NSData *)data;
+
+/** Initializes the lexer to tokenize the given UTF-8 data.
+
+ This is the designated initializer. The data is not copied, all records refer directly to its bytes, so memory mapped data can be used to avoid reading the whole file into memory. Optional UTF-8 byte order mark at the start of the data is ignored.
+
+ @param data UTF-8 encoded data to tokenize.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given data is `nil`.
+ */
+- (id)initWithData:(NSData *)data;
+
+/** Determines whether the given data contains valid UTF-8.
+
+ Validation is done in place, without decoding the data; overlong encodings, surrogates and code points above U+10FFFF are rejected. Use this to verify data before passing it to `lexerWithData:` as the lexer itself doesn't validate its input.
+
+ @param data The data to verify.
+ @return Returns `YES` if the data is valid UTF-8, `NO` otherwise.
+ */
++ (BOOL)isValidUTF8Data:(NSData *)data;
+
+///---------------------------------------------------------------------------------------
+/// @name Tokens handling
+///---------------------------------------------------------------------------------------
+
+/** Returns the record of the token at the given index.
+
+ @param index The index of the token.
+ @return Returns the record describing the token.
+ @exception NSException Thrown if the index is out of bounds.
+ */
+- (GBLexerRecord)recordAtIndex:(NSUInteger)index;
+
+/** Returns the string value of the token at the given index.
+
+ A new string is decoded from input data on each call; use `tokenAtIndex:` if the same value is needed multiple times.
+
+ @param index The index of the token.
+ @return Returns the string value of the token.
+ @exception NSException Thrown if the index is out of bounds.
+ */
+- (NSString *)stringForRecordAtIndex:(NSUInteger)index;
+
+/** Returns the token object for the token at the given index.
+
+ The token object is created on first request for the given index and cached for subsequent ones.
+
+ @param index The index of the token.
+ @return Returns `GBLexerToken` describing the token.
+ @exception NSException Thrown if the index is out of bounds.
+ */
+- (PKToken *)tokenAtIndex:(NSUInteger)index;
+
+/** Determines whether the token at the given index matches the given UTF-8 string.
+
+ Comparison is done on input bytes, so no string or token object is created.
+
+ @param string Zero terminated UTF-8 string to compare with.
+ @param index The index of the token.
+ @return Returns `YES` if token's bytes are equal to the given string, `NO` otherwise.
+ @exception NSException Thrown if the index is out of bounds.
+ */
+- (BOOL)matchesString:(const char *)string atIndex:(NSUInteger)index;
+
+/** The number of tokens found in the input. */
+@property (readonly) NSUInteger numberOfTokens;
+
+/** UTF-8 input data. */
+@property (readonly) NSData *data;
+
+@end
+
+#pragma mark -
+
+/** `PKToken` created from `GBLexerRecord`.
+
+ The token behaves as any other `PKToken`, but additionally provides the line and length of the token in bytes. Note that `offset` returns the offset in bytes within UTF-8 input.
+ */
+@interface GBLexerToken : PKToken {
+	@private
+	NSUInteger _byteOffset;
+	NSUInteger _byteLength;
+	NSUInteger _line;
+}
+
+/** Returns autoreleased token for the given record and string value.
+
+ @param record The record describing the token.
+ @param string The string value of the token.
+ @return Returns initialized instance.
+ */
++ (id)tokenWithRecord:(GBLexerRecord)record stringValue:(NSString *)string;
+
+/** The length of the token in bytes within UTF-8 input. */
+@property (readonly) NSUInteger byteLength;
+
+/** The 1 based number of the line on which the token starts. */
+@property (readonly) NSUInteger line;
+
+@end
@@ -0,0 +1,260 @@
+//
+//  GBLexer.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBLexer.h"
+
+// Character classes used by the scanner; these mimic default PKTokenizer states with '_' added to word start characters. Any non-ASCII byte is treated as word character, so UTF-8 sequences are never split.
+#define GBLexerIsDigit(c) ((c) >= '0' && (c) <= '9')
+#define GBLexerIsLetter(c) (((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z'))
+#define GBLexerIsWordStart(c) (GBLexerIsLetter(c) || (c) == '_' || (c) >= 0x80)
+#define GBLexerIsWordChar(c) (GBLexerIsWordStart(c) || GBLexerIsDigit(c) || (c) == '-' || (c) == '\'')
+#define GBLexerIsWhitespace(c) ((c) <= ' ')
+#define GBLexerIsHandleChar(c) (GBLexerIsLetter(c) || GBLexerIsDigit(c) || (c) == '_')
+
+@interface GBLexer ()
+
+- (void)scanBytes:(const unsigned char *)bytes length:(NSUInteger)length;
+- (void)addRecordWithType:(PKTokenType)type start:(NSUInteger)start end:(NSUInteger)end line:(NSUInteger)line;
+- (GBLexerRecord *)recordPointerAtIndex:(NSUInteger)index;
+
+@end
+
+#pragma mark -
+
+@implementation GBLexer
+
+#pragma mark Initialization & disposal
+
++ (id)lexerWithString:(NSString *)string {
+	NSParameterAssert(string != nil);
+	return [self lexerWithData:[string dataUsingEncoding:NSUTF8StringEncoding]];
+}
+
++ (id)lexerWithData:(NSData *)data {
+	return [[[self alloc] initWithData:data] autorelease];
+}
+
+- (id)initWithData:(NSData *)data {
+	NSParameterAssert(data != nil);
+	self = [super init];
+	if (self) {
+		_data = [data retain];
+		_records = [[NSMutableData alloc] initWithCapacity:([data length] / 4) * sizeof(GBLexerRecord)];
+		[self scanBytes:[data bytes] length:[data length]];
+		_tokens = [[NSPointerArray alloc] initWithOptions:NSPointerFunctionsStrongMemory];
+		[_tokens setCount:_numberOfTokens];
+	}
+	return self;
+}
+
+- (void)dealloc {
+	[_data release];
+	[_records release];
+	[_tokens release];
+	[super dealloc];
+}
+
+#pragma mark Validation
+
++ (BOOL)isValidUTF8Data:(NSData *)data {
+	const unsigned char *bytes = [data bytes];
+	NSUInteger length = [data length];
+	NSUInteger i = 0;
+	while (i < length) {
+		unsigned char c = bytes[i];
+		if (c < 0x80) {
+			i++;
+			continue;
+		}
+		
+		// Determine the length of the sequence and the allowed range of the second byte; this rejects overlong encodings, surrogates and code points above U+10FFFF.
+		NSUInteger count;
+		unsigned char min = 0x80, max = 0xBF;
+		if (c >= 0xC2 && c <= 0xDF) count = 2;
+		else if (c == 0xE0) { count = 3; min = 0xA0; }
+		else if (c == 0xED) { count = 3; max = 0x9F; }
+		else if (c >= 0xE1 && c <= 0xEF) count = 3;
+		else if (c == 0xF0) { count = 4; min = 0x90; }
+		else if (c == 0xF4) { count = 4; max = 0x8F; }
+		else if (c >= 0xF1 && c <= 0xF3) count = 4;
+		else return NO;
+		if (i + count > length) return NO;
+		if (bytes[i + 1] < min || bytes[i + 1] > max) return NO;
+		for (NSUInteger j = 2; j < count; j++) {
+			if ((bytes[i + j] & 0xC0) != 0x80) return NO;
+		}
+		i += count;
+	}
+	return YES;
+}
+
+#pragma mark Scanning
+
+- (void)scanBytes:(const unsigned char *)bytes length:(NSUInteger)length {
+	// All tokens are scanned in a single pass over the input. Lines are counted the same way as GBLineIndex counts them: each '\n' or '\r' starts a new line.
+	NSUInteger line = 1;
+	NSUInteger i = 0;
+	if (length >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF) i = 3;
+	while (i < length) {
+		unsigned char c = bytes[i];
+
+		// Whitespace is skipped, but we need to track lines.
+		if (GBLexerIsWhitespace(c)) {
+			if (c == '\n' || c == '\r') line++;
+			i++;
+			continue;
+		}
+
+		NSUInteger start = i;
+		NSUInteger startLine = line;
+		unsigned char next = (i + 1 < length) ? bytes[i + 1] : 0;
+
+		// Comments; only appledoc comments are reported, others are skipped like whitespace. Single line comments end before the line break, multiple line comments at the closing "*/" or at the end of input.
+		if (c == '/' && next == '/') {
+			i += 2;
+			while (i < length && bytes[i] != '\n' && bytes[i] != '\r') i++;
+			if (i - start >= 3 && bytes[start + 2] == '/') [self addRecordWithType:PKTokenTypeComment start:start end:i line:startLine];
+			continue;
+		}
+		if (c == '/' && next == '*') {
+			i += 2;
+			while (i < length) {
+				if (bytes[i] == '*' && i + 1 < length && bytes[i + 1] == '/') {
+					i += 2;
+					break;
+				}
+				if (bytes[i] == '\n' || bytes[i] == '\r') line++;
+				i++;
+			}
+			if (i - start >= 3 && bytes[start + 2] == '*') [self addRecordWithType:PKTokenTypeComment start:start end:i line:startLine];
+			continue;
+		}
+
+		// Words.
+		if (GBLexerIsWordStart(c)) {
+			i++;
+			while (i < length && GBLexerIsWordChar(bytes[i])) i++;
+			[self addRecordWithType:PKTokenTypeWord start:start end:i line:startLine];
+			continue;
+		}
+
+		// Numbers; optional minus, integer part and optional fraction. Minus or dot that isn't followed by a digit is a symbol.
+		unsigned char afterNext = (i + 2 < length) ? bytes[i + 2] : 0;
+		BOOL isNumber = GBLexerIsDigit(c);
+		if (!isNumber && c == '.') isNumber = GBLexerIsDigit(next);
+		if (!isNumber && c == '-') isNumber = GBLexerIsDigit(next) || (next == '.' && GBLexerIsDigit(afterNext));
+		if (isNumber) {
+			if (c == '-') i++;
+			while (i < length && GBLexerIsDigit(bytes[i])) i++;
+			if (i + 1 < length && bytes[i] == '.' && GBLexerIsDigit(bytes[i + 1])) {
+				i++;
+				while (i < length && GBLexerIsDigit(bytes[i])) i++;
+			}
+			[self addRecordWithType:PKTokenTypeNumber start:start end:i line:startLine];
+			continue;
+		}
+
+		// Quoted strings; end with the same quote character or at the end of input.
+		if (c == '"' || c == '\'') {
+			i++;
+			while (i < length && bytes[i] != c) {
+				if (bytes[i] == '\\' && i + 1 < length) i++;
+				if (bytes[i] == '\n' || bytes[i] == '\r') line++;
+				i++;
+			}
+			if (i < length) i++;
+			[self addRecordWithType:PKTokenTypeQuotedString start:start end:i line:startLine];
+			continue;
+		}
+
+		// Keywords such as @interface or @end; PKTokenizer reports these as single twitter handle tokens. If @ isn't followed by a name, it's an ordinary symbol.
+		if (c == '@' && GBLexerIsHandleChar(next)) {
+			i++;
+			while (i < length && GBLexerIsHandleChar(bytes[i])) i++;
+			[self addRecordWithType:PKTokenTypeTwitter start:start end:i line:startLine];
+			continue;
+		}
+
+		// Symbols; besides single characters we recognize all multiple character symbols PKTokenizer and GBObjectiveCParser register.
+		i++;
+		if (c == '.' && next == '.' && afterNext == '.')
+			i += 2;
+		else if ((c == '<' || c == '>' || c == '!' || c == '=') && next == '=')
+			i++;
+		[self addRecordWithType:PKTokenTypeSymbol start:start end:i line:startLine];
+	}
+}
+
+- (void)addRecordWithType:(PKTokenType)type start:(NSUInteger)start end:(NSUInteger)end line:(NSUInteger)line {
+	GBLexerRecord record = { type, start, end - start, line };
+	[_records appendBytes:&record length:sizeof(GBLexerRecord)];
+	_numberOfTokens++;
+}
+
+#pragma mark Tokens handling
+
+- (GBLexerRecord *)recordPointerAtIndex:(NSUInteger)index {
+	if (index >= _numberOfTokens) [NSException raise:NSRangeException format:@"Token index %lu out of bounds %lu!", index, _numberOfTokens];
+	return (GBLexerRecord *)[_records mutableBytes] + index;
+}
+
+- (GBLexerRecord)recordAtIndex:(NSUInteger)index {
+	return *[self recordPointerAtIndex:index];
+}
+
+- (NSString *)stringForRecordAtIndex:(NSUInteger)index {
+	GBLexerRecord *record = [self recordPointerAtIndex:index];
+	const char *bytes = (const char *)[_data bytes] + record->offset;
+	return [[[NSString alloc] initWithBytes:bytes length:record->length encoding:NSUTF8StringEncoding] autorelease];
+}
+
+- (PKToken *)tokenAtIndex:(NSUInteger)index {
+	PKToken *result = [_tokens pointerAtIndex:index];
+	if (!result) {
+		GBLexerRecord *record = [self recordPointerAtIndex:index];
+		result = [GBLexerToken tokenWithRecord:*record stringValue:[self stringForRecordAtIndex:index]];
+		[_tokens replacePointerAtIndex:index withPointer:result];
+	}
+	return result;
+}
+
+- (BOOL)matchesString:(const char *)string atIndex:(NSUInteger)index {
+	GBLexerRecord *record = [self recordPointerAtIndex:index];
+	size_t length = strlen(string);
+	if (record->length != length) return NO;
+	return (memcmp((const char *)[_data bytes] + record->offset, string, length) == 0);
+}
+
+#pragma mark Properties
+
+@synthesize numberOfTokens = _numberOfTokens;
+@synthesize data = _data;
+
+@end
+
+#pragma mark -
+
+@implementation GBLexerToken
+
++ (id)tokenWithRecord:(GBLexerRecord)record stringValue:(NSString *)string {
+	CGFloat value = (record.type == PKTokenTypeNumber) ? [string doubleValue] : 0.0;
+	GBLexerToken *result = [[[self alloc] initWithTokenType:record.type stringValue:string floatValue:value] autorelease];
+	result->_byteOffset = record.offset;
+	result->_byteLength = record.length;
+	result->_line = record.line;
+	return result;
+}
+
+- (NSUInteger)offset {
+	return _byteOffset;
+}
+
+@synthesize byteLength = _byteLength;
+@synthesize line = _line;
+
+@end
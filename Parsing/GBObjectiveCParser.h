@@ -12,6 +12,14 @@
  
  The main responsibility of this class is encapsulation of Objective-C source code parsing into in-memory representation. As we're only parsing a small subset of Objective-C and even then we don't need to handle much specifics beyond recognizing different classes, variables, methods etc., overall the parsing process is quite simple. Basically we use ParseKit's `PKTokenizer` to split given input string into tokens and then traverse the list of tokens to get the data we need.
  */
+/** Describes what a source file contains, as determined by `[GBObjectiveCParser contentsOfSourceData:]`. */
+enum {
+	GBSourceContentsObjects = 1 << 0,	//< Source contains at least one `@interface`, `@protocol` or `@implementation` keyword.
+};
+typedef NSUInteger GBSourceContents;
+
+#pragma mark -
+
 @interface GBObjectiveCParser : NSObject
 
 ///---------------------------------------------------------------------------------------
@@ -53,4 +61,26 @@
  */
 - (void)parseObjectsFromString:(NSString *)input sourceFile:(NSString *)filename toStore:(id)store;
 
+/** Parses all objects from the given UTF-8 data.
+ 
+ The method adds all detected objects to the given store. Unless ParseKit tokenizer is requested through settings, the data is tokenized directly, without decoding it to a string first; only values of tokens the parser inspects are decoded. This makes it possible to parse memory mapped files without ever holding their whole contents in memory. The data must contain valid UTF-8, use `[GBLexer isValidUTF8Data:]` to verify it.
+ 
+ @param data UTF-8 encoded data to parse from.
+ @param filename The name of the file including extension.
+ @param store Store into which the objects should be added.
+ @exception NSException Thrown if the given data or store is `nil`.
+ @see parseObjectsFromString:sourceFile:toStore:
+ */
+- (void)parseObjectsFromData:(NSData *)data sourceFile:(NSString *)filename toStore:(id)store;
+
+/** Quickly determines what the given UTF-8 source data contains without parsing it.
+ 
+ The data is only searched for raw byte sequences, so the result may report objects which are actually within strings or comments, but never misses real ones. Clients can use the result to skip files that can't contribute anything to the store: a file without objects keywords never yields any object.
+ 
+ @param data UTF-8 encoded data to scan.
+ @return Returns combination of `GBSourceContents` flags.
+ @exception NSException Thrown if the given data is `nil`.
+ */
++ (GBSourceContents)contentsOfSourceData:(NSData *)data;
+
 @end
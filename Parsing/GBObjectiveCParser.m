@@ -10,6 +10,8 @@
 #import "ParseKit.h"
 #import "PKToken+GBToken.h"
 #import "GBTokenizer.h"
+#import "GBLexer.h"
+#import "GBProfiler.h"
 #import "GBStore.h"
 #import "GBApplicationSettingsProvider.h"
 #import "GBDataObjects.h"
@@ -17,6 +19,7 @@
 
 @interface GBObjectiveCParser ()
 
+- (void)parseObjectsFromTokenizerForFile:(NSString *)filename;
 - (PKTokenizer *)tokenizerWithInputString:(NSString *)input;
 @property (retain) GBTokenizer *tokenizer;
 @property (retain) GBStore *store;
@@ -90,12 +93,62 @@
 	NSParameterAssert(store != nil);
 	GBLogDebug(@"Parsing objective-c objects...");
 	self.store = store;
-	self.tokenizer = [GBTokenizer tokenizerWithSource:[self tokenizerWithInputString:input] filename:filename];
+	GBProfileBegin(tokenizeSample);
+	if (self.settings.useParseKitTokenizer)
+		self.tokenizer = [GBTokenizer tokenizerWithSource:[self tokenizerWithInputString:input] filename:filename];
+	else
+		self.tokenizer = [GBTokenizer tokenizerWithLexer:[GBLexer lexerWithString:input] filename:filename];
+	GBProfileEndFile(tokenizeSample, kGBProfilerPhaseTokenize, filename);
+	[self parseObjectsFromTokenizerForFile:filename];
+}
+
+- (void)parseObjectsFromData:(NSData *)data sourceFile:(NSString *)filename toStore:(id)store {
+	NSParameterAssert(data != nil);
+	NSParameterAssert(filename != nil);
+	NSParameterAssert([filename length] > 0);
+	NSParameterAssert(store != nil);
+	if (self.settings.useParseKitTokenizer) {
+		NSString *input = [[[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] autorelease];
+		[self parseObjectsFromString:input sourceFile:filename toStore:store];
+		return;
+	}
+	GBLogDebug(@"Parsing objective-c objects...");
+	self.store = store;
+	GBProfileBegin(tokenizeSample);
+	self.tokenizer = [GBTokenizer tokenizerWithLexer:[GBLexer lexerWithData:data] filename:filename];
+	GBProfileEndFile(tokenizeSample, kGBProfilerPhaseTokenize, filename);
+	[self parseObjectsFromTokenizerForFile:filename];
+}
+
++ (GBSourceContents)contentsOfSourceData:(NSData *)data {
+	// Uses memchr to jump to candidate characters, so that most of the input is handled by vectorized library code. The search stops as soon as a match is found.
+	NSParameterAssert(data != nil);
+	const char *bytes = [data bytes];
+	const char *end = bytes + [data length];
+	GBSourceContents result = 0;
+	const char *p = bytes;
+	while ((p = memchr(p, '@', end - p)) != NULL) {
+		size_t left = end - p;
+		if ((left >= 10 && memcmp(p, "@interface", 10) == 0) || (left >= 9 && memcmp(p, "@protocol", 9) == 0) || (left >= 15 && memcmp(p, "@implementation", 15) == 0)) {
+			result |= GBSourceContentsObjects;
+			break;
+		}
+		p++;
+	}
+	return result;
+}
+
+- (void)parseObjectsFromTokenizerForFile:(NSString *)filename {
+	// Release tokenizer when done; with mapped input data, this also unmaps the file as soon as possible.
+	GBProfileBegin(parseSample);
 	while (![self.tokenizer eof]) {
 		if (![self matchNextObject]) {
 			[self.tokenizer consume:1];
 		}
 	}
+	GBProfileEndFile(parseSample, kGBProfilerPhaseParse, filename);
+	GBProfileCount(@"parsedFiles", 1);
+	self.tokenizer = nil;
 }
 
 - (PKTokenizer *)tokenizerWithInputString:(NSString *)input {
@@ -119,6 +172,7 @@
 
 - (void)matchClassDefinition {
 	// @interface CLASSNAME
+	GBProfileBegin(matchSample);
 	NSString *className = [[self.tokenizer lookahead:1] stringValue];
 	GBClassData *class = [GBClassData classDataWithName:className];
 	GBLogVerbose(@"Matched %@ class definition.", className);
@@ -130,10 +184,12 @@
 	[self matchIvarsForProvider:class.ivars];
 	[self matchMethodDefinitionsForProvider:class.methods defaultsRequired:NO];
 	[self.store registerClass:class];
+	GBProfileEndObject(matchSample, kGBProfilerPhaseMatch, class);
 }
 
 - (void)matchCategoryDefinition {
 	// @interface CLASSNAME ( CATEGORYNAME )
+	GBProfileBegin(matchSample);
 	NSString *className = [[self.tokenizer lookahead:1] stringValue];
 	NSString *categoryName = [[self.tokenizer lookahead:3] stringValue];
 	GBCategoryData *category = [GBCategoryData categoryDataWithName:categoryName className:className];
@@ -144,10 +200,12 @@
 	[self matchAdoptedProtocolForProvider:category.adoptedProtocols];
 	[self matchMethodDefinitionsForProvider:category.methods defaultsRequired:NO];
 	[self.store registerCategory:category];
+	GBProfileEndObject(matchSample, kGBProfilerPhaseMatch, category);
 }
 
 - (void)matchExtensionDefinition {
 	// @interface CLASSNAME ( )
+	GBProfileBegin(matchSample);
 	NSString *className = [[self.tokenizer lookahead:1] stringValue];
 	GBCategoryData *extension = [GBCategoryData categoryDataWithName:nil className:className];
 	GBLogVerbose(@"Matched %@() extension definition.", className);
@@ -157,10 +215,12 @@
 	[self matchAdoptedProtocolForProvider:extension.adoptedProtocols];
 	[self matchMethodDefinitionsForProvider:extension.methods defaultsRequired:NO];
 	[self.store registerCategory:extension];
+	GBProfileEndObject(matchSample, kGBProfilerPhaseMatch, extension);
 }
 
 - (void)matchProtocolDefinition {
 	// @protocol PROTOCOLNAME
+	GBProfileBegin(matchSample);
 	NSString *protocolName = [[self.tokenizer lookahead:1] stringValue];
 	GBProtocolData *protocol = [GBProtocolData protocolDataWithName:protocolName];
 	GBLogVerbose(@"Matched %@ protocol definition.", protocolName);
@@ -170,6 +230,7 @@
 	[self matchAdoptedProtocolForProvider:protocol.adoptedProtocols];
 	[self matchMethodDefinitionsForProvider:protocol.methods defaultsRequired:YES];
 	[self.store registerProtocol:protocol];
+	GBProfileEndObject(matchSample, kGBProfilerPhaseMatch, protocol);
 }
 
 - (void)matchSuperclassForClass:(GBClassData *)class {
@@ -281,6 +342,7 @@
 
 - (void)matchClassDeclaration {
 	// @implementation CLASSNAME
+	GBProfileBegin(matchSample);
 	NSString *className = [[self.tokenizer lookahead:1] stringValue];
 	GBClassData *class = [GBClassData classDataWithName:className];
 	GBLogVerbose(@"Matched %@ class declaration.", className);
@@ -289,10 +351,12 @@
 	[self.tokenizer consume:2];
 	[self matchMethodDeclarationsForProvider:class.methods defaultsRequired:NO];
 	[self.store registerClass:class];
+	GBProfileEndObject(matchSample, kGBProfilerPhaseMatch, class);
 }
 
 - (void)matchCategoryDeclaration {
 	// @implementation CLASSNAME ( CATEGORYNAME )
+	GBProfileBegin(matchSample);
 	NSString *className = [[self.tokenizer lookahead:1] stringValue];
 	NSString *categoryName = [[self.tokenizer lookahead:3] stringValue];
 	GBCategoryData *category = [GBCategoryData categoryDataWithName:categoryName className:className];
@@ -302,6 +366,7 @@
 	[self.tokenizer consume:5];
 	[self matchMethodDeclarationsForProvider:category.methods defaultsRequired:NO];
 	[self.store registerCategory:category];
+	GBProfileEndObject(matchSample, kGBProfilerPhaseMatch, category);
 }
 
 - (void)matchMethodDeclarationsForProvider:(GBMethodsProvider *)provider defaultsRequired:(BOOL)required {
@@ -326,21 +391,8 @@
 }
 
 - (void)consumeMethodBody {
-	// This method assumes we're currently pointing to the first token after method's opening brace!
-	__block NSUInteger braceLevel = 1;
-	[self.tokenizer consumeTo:@"@end" usingBlock:^(PKToken *token, BOOL *consume, BOOL *stop) {
-		if ([token matches:@"{"]) {
-			braceLevel++;
-			return;
-		}
-		if ([token matches:@"}"]) {
-			if (--braceLevel == 0) {
-				*consume = NO;
-				*stop = YES;
-			}
-			return;
-		}
-	}];
+	// This method assumes we're currently pointing to the first token after method's opening brace! Method bodies don't contribute anything to documentation, so we let the tokenizer skip them without inspecting tokens.
+	[self.tokenizer consumeBlockBodyTo:@"@end"];
 }
 
 @end
@@ -46,6 +46,8 @@
  
  If any kind of inconsistency is detected in source code, a warning is logged and parsing continues. This allows us to extract as much information as possible, while ignoring problems.
  
+ Files within each directory are collected in name order, before files from its subdirectories, which are also handled in name order. This makes the order of parsing, and thus the resulting store, independent of the file system, even though subdirectories may be scanned concurrently.
+ 
  @warning *Note:* The method expects the given array contains `NSString`s representing existing directory or file names. The method itself doesn't validate this and may result in unpredictable behavior in case an invalid path is passed in. The paths don't have to be standardized, expanded or similar though.
  
  @param paths An array of strings representing paths to parse.
@@ -54,4 +56,22 @@
  */
 - (void)parseObjectsFromPaths:(NSArray *)paths toStore:(id)store;
 
+///---------------------------------------------------------------------------------------
+/// @name Statistics
+///---------------------------------------------------------------------------------------
+
+/** The number of source files skipped during last `parseObjectsFromPaths:toStore:` because they couldn't contribute anything to the store.
+ 
+ Before parsing, each file is scanned with `[GBObjectiveCParser contentsOfSourceData:]` and files without any object are skipped. Files without appledoc comments are still parsed, as their objects may be merged into documented objects from other files.
+ 
+ @see numberOfSkippedBytes
+ */
+@property (readonly) NSUInteger numberOfSkippedFiles;
+
+/** The total size in bytes of source files skipped during last `parseObjectsFromPaths:toStore:`.
+ 
+ @see numberOfSkippedFiles
+ */
+@property (readonly) unsigned long long numberOfSkippedBytes;
+
 @end
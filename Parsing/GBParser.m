@@ -6,21 +6,42 @@
 //  Copyright (C) 2010, Gentle Bytes. All rights reserved.
 //
 
+#import <libkern/OSAtomic.h>
+#import <dirent.h>
+#import <sys/stat.h>
 #import "GBStore.h"
 #import "GBApplicationSettingsProvider.h"
 #import "GBObjectiveCParser.h"
+#import "GBLexer.h"
+#import "GBParserCache.h"
+#import "GBProfiler.h"
+#import "GBPathMatcher.h"
 #import "GBParser.h"
 
+static NSString *kGBParserCacheFilename = @".appledoc-cache.plist";
+
 @interface GBParser ()
 
-- (void)parseDirectory:(NSString *)path;
-- (void)parseFile:(NSString *)path;
+- (NSArray *)sourceFilesFromDirectory:(NSString *)path threads:(NSUInteger)threads;
+- (BOOL)isCollectableSourceFile:(NSString *)path;
+- (void)parseSourceFilesSerially;
+- (void)parseSourceFilesConcurrentlyWithThreads:(NSUInteger)threads;
+- (BOOL)parseFile:(NSString *)path withParser:(GBObjectiveCParser *)parser toStore:(id)store;
+- (BOOL)shouldSkipFile:(NSString *)path withData:(NSData *)data;
+- (void)loadParserCache;
+- (void)writeParserCache;
 - (BOOL)isPathIgnored:(NSString *)path;
 - (BOOL)isFileIgnored:(NSString *)filename;
 - (BOOL)isDirectoryIgnored:(NSString *)filename;
 - (BOOL)isSourceCodeFile:(NSString *)path;
+@property (readonly) NSUInteger numberOfThreadsToUse;
 @property (assign) NSUInteger numberOfParsedFiles;
+@property (readwrite) NSUInteger numberOfSkippedFiles;
+@property (readwrite) unsigned long long numberOfSkippedBytes;
+@property (retain) NSMutableArray *sourceFiles;
+@property (retain) GBPathMatcher *ignoredPathsMatcher;
 @property (retain) GBObjectiveCParser *objectiveCParser;
+@property (retain) GBParserCache *parserCache;
 @property (retain) GBStore *store;
 @property (retain) GBApplicationSettingsProvider *settings;
 
@@ -55,72 +76,225 @@
 	GBLogVerbose(@"Parsing objects from %u paths...", [paths count]);
 	self.store = store;
 	self.numberOfParsedFiles = 0;
+	self.numberOfSkippedFiles = 0;
+	self.numberOfSkippedBytes = 0;
+	self.sourceFiles = [NSMutableArray array];
+	self.ignoredPathsMatcher = [GBPathMatcher matcherWithSuffixes:self.settings.ignoredPaths];
+	[self loadParserCache];
+	GBProfileBegin(discovery);
 	for (NSString *path in paths) {
 		GBLogVerbose(@"Parsing '%@'...", path);
 		if ([self.fileManager isPathDirectory:path]) {
-			[self parseDirectory:path];
-		} else {
-			[self parseFile:path];
+			[self.sourceFiles addObjectsFromArray:[self sourceFilesFromDirectory:path threads:self.numberOfThreadsToUse]];
+		} else if ([self isCollectableSourceFile:path]) {
+			[self.sourceFiles addObject:path];
 		}
 	}
+	GBProfileEnd(discovery, kGBProfilerPhaseDiscover);
+	
+	NSUInteger threads = MIN(self.numberOfThreadsToUse, [self.sourceFiles count]);
+	if (threads > 1) {
+		[self parseSourceFilesConcurrentlyWithThreads:threads];
+	} else {
+		[self parseSourceFilesSerially];
+	}
+	[self writeParserCache];
+	if (self.numberOfSkippedFiles > 0) GBLogNormal(@"Skipped %u files (%llu bytes) without objects.", self.numberOfSkippedFiles, self.numberOfSkippedBytes);
+	self.sourceFiles = nil;
+	self.ignoredPathsMatcher = nil;
 }
 
-- (void)parseDirectory:(NSString *)path {	
-	GBLogDebug(@"Parsing path '%@'...", path);
+- (NSArray *)sourceFilesFromDirectory:(NSString *)path threads:(NSUInteger)threads {
+	// Entry types are taken from readdir, so we only need to stat symbolic links (which are followed as before) and entries on file systems that don't report types. Files come first, then files from subdirectories; both are sorted by name so that the result doesn't depend on file system order. Subdirectories are scanned concurrently by at most the given number of workers, each scanning its subdirectories serially, so the number of threads is bounded regardless of the depth; their results are stored by index, so the order is the same as when scanning serially.
+	GBLogDebug(@"Scanning path '%@'...", path);
 	if ([self isPathIgnored:path]) {
 		GBLogNormal(@"Ignoring path '%@'...", path);
-		return;
+		return [NSArray array];
 	}
-
-	NSError *error = nil;
-	NSArray *contents = [self.fileManager contentsOfDirectoryAtPath:path error:&error];
-	if (error) {
+	
+	DIR *dir = opendir([path fileSystemRepresentation]);
+	if (!dir) {
+		NSError *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
 		GBLogNSError(error, @"Failed fetching contents of '%@'!", path);
-		return;
+		return [NSArray array];
 	}
-	
-	// First process files. Skip ignored files.
-	for (NSString *subpath in contents) {
+	NSMutableArray *files = [NSMutableArray array];
+	NSMutableArray *directories = [NSMutableArray array];
+	struct dirent *entry;
+	while ((entry = readdir(dir)) != NULL) {
+		if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+		NSString *subpath = [self.fileManager stringWithFileSystemRepresentation:entry->d_name length:strlen(entry->d_name)];
 		NSString *fullPath = [path stringByAppendingPathComponent:subpath];
-		if ([self.fileManager isPathDirectory:fullPath]) continue;
-		if ([self isFileIgnored:subpath]) continue;
-		[self parseFile:fullPath];
+		BOOL isDirectory = (entry->d_type == DT_DIR);
+		if (entry->d_type == DT_LNK || entry->d_type == DT_UNKNOWN) {
+			struct stat info;
+			isDirectory = (stat([fullPath fileSystemRepresentation], &info) == 0 && S_ISDIR(info.st_mode));
+		}
+		if (isDirectory) {
+			if ([self isDirectoryIgnored:subpath]) continue;
+			[directories addObject:fullPath];
+		} else {
+			if ([self isFileIgnored:subpath]) continue;
+			if (![self isCollectableSourceFile:fullPath]) continue;
+			[files addObject:fullPath];
+		}
 	}
+	closedir(dir);
+	[files sortUsingSelector:@selector(compare:)];
+	[directories sortUsingSelector:@selector(compare:)];
 	
-	// Now process all subdirectories. Skip ignored directories.
-	for (NSString *subpath in contents) {
-		NSString *fullPath = [path stringByAppendingPathComponent:subpath];
-		if (![self.fileManager isPathDirectory:fullPath]) continue;
-		if ([self isDirectoryIgnored:subpath]) continue;
-		[self parseDirectory:fullPath];
+	if (threads > 1 && [directories count] > 1) {
+		threads = MIN(threads, [directories count]);
+		int32_t count = (int32_t)[directories count];
+		NSMutableArray *results = [NSMutableArray arrayWithCapacity:count];
+		for (int32_t i=0; i<count; i++) [results addObject:[NSNull null]];
+		__block int32_t lastIndex = -1;
+		dispatch_apply(threads, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t worker) {
+			int32_t index;
+			while ((index = OSAtomicIncrement32(&lastIndex)) < count) {
+				NSAutoreleasePool *pool = [[NSAutoreleasePool alloc] init];
+				NSArray *subfiles = [self sourceFilesFromDirectory:[directories objectAtIndex:index] threads:1];
+				@synchronized(results) {
+					[results replaceObjectAtIndex:index withObject:subfiles];
+				}
+				[pool drain];
+			}
+		});
+		for (NSArray *subfiles in results) [files addObjectsFromArray:subfiles];
+	} else {
+		for (NSString *directory in directories) [files addObjectsFromArray:[self sourceFilesFromDirectory:directory threads:threads]];
 	}
+	return files;
 }
 
-- (void)parseFile:(NSString *)path {
-	GBLogDebug(@"Parsing file '%@'...", path);
+- (BOOL)isCollectableSourceFile:(NSString *)path {
+	GBLogDebug(@"Scanning file '%@'...", path);
 	if ([self isPathIgnored:path]) {
 		GBLogNormal(@"Ignoring file '%@'...", path);
-		return;
+		return NO;
+	}
+	return [self isSourceCodeFile:path];
+}
+
+- (void)parseSourceFilesSerially {
+	for (NSString *path in self.sourceFiles) {
+		if ([self parseFile:path withParser:self.objectiveCParser toStore:self.store]) self.numberOfParsedFiles++;
 	}
-	if (![self isSourceCodeFile:path]) return;	
+}
+
+- (void)parseSourceFilesConcurrentlyWithThreads:(NSUInteger)threads {
+	// Each worker uses its own Objective-C parser and parses each file into a private store. Once all workers are done, private stores are merged into the main store in the same order as files would be parsed serially. As merging uses the same rules as registering objects while parsing, the resulting store doesn't depend on the number of workers. Exceptions can't propagate out of GCD blocks, so we remember the first one and raise it after all workers finish.
+	GBLogVerbose(@"Parsing %u files using %u threads...", [self.sourceFiles count], threads);
+	NSArray *files = self.sourceFiles;
+	int32_t count = (int32_t)[files count];
+	NSMutableArray *stores = [NSMutableArray arrayWithCapacity:count];
+	for (int32_t i=0; i<count; i++) [stores addObject:[NSNull null]];
+	__block int32_t lastIndex = -1;
+	__block NSException *exception = nil;
+	dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+	dispatch_apply(threads, queue, ^(size_t worker) {
+		GBObjectiveCParser *parser = [[GBObjectiveCParser alloc] initWithSettingsProvider:self.settings];
+		int32_t index;
+		while ((index = OSAtomicIncrement32(&lastIndex)) < count) {
+			NSAutoreleasePool *pool = [[NSAutoreleasePool alloc] init];
+			GBStore *store = [[GBStore alloc] init];
+			@try {
+				if ([self parseFile:[files objectAtIndex:index] withParser:parser toStore:store]) {
+					@synchronized(stores) {
+						[stores replaceObjectAtIndex:index withObject:store];
+					}
+				}
+			}
+			@catch (NSException *e) {
+				@synchronized(self) {
+					if (!exception) exception = [e retain];
+				}
+			}
+			[store release];
+			[pool drain];
+		}
+		[parser release];
+	});
 	
-	GBLogInfo(@"Parsing source code from '%@'...", path);
+	if (exception) [[exception autorelease] raise];
+	for (GBStore *store in stores) {
+		if ((id)store == [NSNull null]) continue;
+		[self.store registerObjectsFromStore:store];
+		self.numberOfParsedFiles++;
+	}
+}
+
+- (BOOL)parseFile:(NSString *)path withParser:(GBObjectiveCParser *)parser toStore:(id)store {
+	// Source files are memory mapped and validated in place, then passed to the parser as raw UTF-8 data, so we never hold decoded contents of whole files. The same data is used for hashing when caching.
 	NSError *error = nil;
-	NSString *input = [NSString stringWithContentsOfFile:path encoding:NSUTF8StringEncoding error:&error];
-	if (error) {
+	NSString *key = [path stringByStandardizingPath];
+	GBProfileBegin(readSample);
+	NSData *data = [NSData dataWithContentsOfFile:key options:NSDataReadingMapped error:&error];
+	GBProfileEndFile(readSample, kGBProfilerPhaseRead, [path lastPathComponent]);
+	if (!data) {
 		GBLogNSError(error, @"Failed reading contents of file '%@'!", path);
-		return;
+		return NO;
+	}
+	if ([self shouldSkipFile:path withData:data]) return NO;
+	if (self.parserCache && [self.parserCache registerObjectsForFile:key data:data toStore:store]) {
+		GBLogInfo(@"Using cached data for '%@'...", path);
+		GBProfileCount(@"cachedFiles", 1);
+		return YES;
+	}
+	if (![GBLexer isValidUTF8Data:data]) {
+		GBLogError(@"Failed reading contents of file '%@' as UTF-8!", path);
+		return NO;
+	}
+	
+	GBLogInfo(@"Parsing source code from '%@'...", path);
+	if (!self.parserCache) {
+		[parser parseObjectsFromData:data sourceFile:[path lastPathComponent] toStore:store];
+		return YES;
 	}
 	
-	[self.objectiveCParser parseObjectsFromString:input sourceFile:[path lastPathComponent] toStore:self.store];
-	self.numberOfParsedFiles++;
+	// When caching, parse the file to a private store, so that we can cache only objects from this file, then register them to the given store.
+	GBStore *fileStore = [[[GBStore alloc] init] autorelease];
+	[parser parseObjectsFromData:data sourceFile:[path lastPathComponent] toStore:fileStore];
+	[self.parserCache cacheObjectsFromStore:fileStore forFile:key data:data];
+	[store registerObjectsFromStore:fileStore];
+	return YES;
 }
 
-- (BOOL)isPathIgnored:(NSString *)path {
-	for (NSString *ignored in self.settings.ignoredPaths) {
-		if ([path hasSuffix:ignored]) return YES;
+- (BOOL)shouldSkipFile:(NSString *)path withData:(NSData *)data {
+	// Files without objects never add anything to the store. Note that files without comments can't be skipped: their objects may merge into documented objects from other files, for example implementation or class extension of a documented class, adding source info and methods. This is checked before cache as it's much cheaper than hashing. Note that this is invoked from concurrent workers too.
+	if ([GBObjectiveCParser contentsOfSourceData:data] & GBSourceContentsObjects) return NO;
+	GBLogInfo(@"Skipping '%@' as it contains no objects...", path);
+	@synchronized(self) {
+		self.numberOfSkippedFiles++;
+		self.numberOfSkippedBytes += [data length];
 	}
-	return NO;
+	GBProfileCount(@"skippedFiles", 1);
+	GBProfileCount(@"skippedBytes", [data length]);
+	return YES;
+}
+
+- (void)loadParserCache {
+	if (!self.settings.cacheParsedFiles) {
+		self.parserCache = nil;
+		return;
+	}
+	NSString *path = [self.settings.outputPath stringByAppendingPathComponent:kGBParserCacheFilename];
+	self.parserCache = [GBParserCache cacheWithSettingsProvider:self.settings];
+	[self.parserCache loadFromFile:path];
+}
+
+- (void)writeParserCache {
+	if (!self.parserCache) return;
+	GBLogNormal(@"Parser cache: %u hits, %u misses.", self.parserCache.numberOfHits, self.parserCache.numberOfMisses);
+	NSString *path = [self.settings.outputPath stringByAppendingPathComponent:kGBParserCacheFilename];
+	NSError *error = nil;
+	if (![self.parserCache writeToFile:path error:&error]) {
+		GBLogNSError(error, @"Failed writting parser cache to '%@'!", path);
+	}
+}
+
+- (BOOL)isPathIgnored:(NSString *)path {
+	return [self.ignoredPathsMatcher matchesPath:path];
 }
 
 - (BOOL)isFileIgnored:(NSString *)filename {
@@ -145,8 +319,18 @@
 
 #pragma mark Properties
 
+- (NSUInteger)numberOfThreadsToUse {
+	if (self.settings.numberOfThreads == 0) return [[NSProcessInfo processInfo] activeProcessorCount];
+	return self.settings.numberOfThreads;
+}
+
 @synthesize numberOfParsedFiles;
+@synthesize numberOfSkippedFiles;
+@synthesize numberOfSkippedBytes;
+@synthesize sourceFiles;
+@synthesize ignoredPathsMatcher;
 @synthesize objectiveCParser;
+@synthesize parserCache;
 @synthesize settings;
 @synthesize store;
 
@@ -0,0 +1,106 @@
+//
+//  GBParserCache.h
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GBStore;
+
+/** Handles caching of parsed source files data between runs.
+
+ The cache stores objects parsed from each source file in the form of property list dictionaries, keyed by file path. Each entry also contains the hash of the file contents, while the cache as a whole is tagged with appledoc version and build. If the cached hash matches the current file contents and the cache was written by the same appledoc build, objects can be registered to the store directly, without parsing the file again.
+
+ Cached objects are restored using the same registration messages as `GBObjectiveCParser` uses while parsing, so the store receives exactly the same data as if the file was parsed. Only data set by the parser is cached; this means the data must be cached before it's passed to `GBProcessor`! The class is thread safe, so it can be used from concurrent parsing workers.
+ */
+@interface GBParserCache : NSObject {
+	@private
+	NSDictionary *_entries;
+	NSMutableDictionary *_updatedEntries;
+}
+
+///---------------------------------------------------------------------------------------
+/// @name Initialization & disposal
+///---------------------------------------------------------------------------------------
+
+/** Returns autoreleased cache that works with the given `GBApplicationSettingsProvider` implementor.
+
+ @param settingsProvider Application-wide settings provider to use for checking parameters.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given application is `nil`.
+ */
++ (id)cacheWithSettingsProvider:(id)settingsProvider;
+
+/** Initializes the cache to work with the given `GBApplicationSettingsProvider` implementor.
+
+ This is the designated initializer.
+
+ @param settingsProvider Application-wide settings provider to use for checking parameters.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given application is `nil`.
+ */
+- (id)initWithSettingsProvider:(id)settingsProvider;
+
+///---------------------------------------------------------------------------------------
+/// @name Persistence handling
+///---------------------------------------------------------------------------------------
+
+/** Loads cached entries from the given file.
+
+ If the file doesn't exist, can't be read or was written by a different appledoc version or build, all previous entries are discarded and the cache starts empty. This is not considered an error; in such case all files are simply parsed again.
+
+ @param path The path to the cache file.
+ @see writeToFile:error:
+ */
+- (void)loadFromFile:(NSString *)path;
+
+/** Writes all entries used during this run to the given file.
+
+ Only entries of files that were either restored or cached during current run are written, so data of removed source files doesn't accumulate in the cache.
+
+ @param path The path to the cache file.
+ @param error If writting fails, error description is returned here.
+ @return Returns `YES` if cache was written, `NO` otherwise.
+ @see loadFromFile:
+ */
+- (BOOL)writeToFile:(NSString *)path error:(NSError **)error;
+
+///---------------------------------------------------------------------------------------
+/// @name Cache handling
+///---------------------------------------------------------------------------------------
+
+/** Registers cached objects of the given file to the given store if cached data is still valid.
+
+ Cached data is valid if it was cached for the same path and the hash of the given file contents matches the cached one. If so, all cached objects are recreated and registered to the store and `numberOfHits` is incremented. Otherwise nothing is registered and `numberOfMisses` is incremented.
+
+ @param path The path of the source file.
+ @param data The contents of the source file.
+ @param store The store to register objects to.
+ @return Returns `YES` if objects were registered from cache, `NO` if the file needs to be parsed.
+ @exception NSException Thrown if any of the parameters is `nil`.
+ @see cacheObjectsFromStore:forFile:data:
+ */
+- (BOOL)registerObjectsForFile:(NSString *)path data:(NSData *)data toStore:(GBStore *)store;
+
+/** Caches all objects from the given store as the objects parsed from the given file.
+
+ The store should only contain objects parsed from the given file, right after parsing. Any previously cached data for the same path is replaced.
+
+ @param store The store containing parsed objects.
+ @param path The path of the source file.
+ @param data The contents of the source file.
+ @exception NSException Thrown if any of the parameters is `nil`.
+ @see registerObjectsForFile:data:toStore:
+ */
+- (void)cacheObjectsFromStore:(GBStore *)store forFile:(NSString *)path data:(NSData *)data;
+
+/** The number of files whose objects were registered from cache. */
+@property (readonly) NSUInteger numberOfHits;
+
+/** The number of files which weren't found in cache or whose cached data was invalid. */
+@property (readonly) NSUInteger numberOfMisses;
+
+@end
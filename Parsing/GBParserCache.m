@@ -0,0 +1,388 @@
+//
+//  GBParserCache.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <CommonCrypto/CommonDigest.h>
+#import "GBStore.h"
+#import "GBApplicationSettingsProvider.h"
+#import "GBDataObjects.h"
+#import "GBParserCache.h"
+
+static NSString *kGBCacheVersionKey = @"version";
+static NSString *kGBCacheEntriesKey = @"entries";
+static NSString *kGBEntryHashKey = @"hash";
+static NSString *kGBEntryClassesKey = @"classes";
+static NSString *kGBEntryCategoriesKey = @"categories";
+static NSString *kGBEntryProtocolsKey = @"protocols";
+
+@interface GBParserCache ()
+
+- (NSString *)hashFromData:(NSData *)data;
+@property (readonly) NSString *cacheVersion;
+@property (readwrite, assign) NSUInteger numberOfHits;
+@property (readwrite, assign) NSUInteger numberOfMisses;
+@property (retain) GBApplicationSettingsProvider *settings;
+
+@end
+
+@interface GBParserCache (Encoding)
+
+- (NSDictionary *)dictionaryFromClass:(GBClassData *)class;
+- (NSDictionary *)dictionaryFromCategory:(GBCategoryData *)category;
+- (NSDictionary *)dictionaryFromProtocol:(GBProtocolData *)protocol;
+- (NSArray *)arrayFromProtocolsProvider:(GBAdoptedProtocolsProvider *)provider;
+- (NSArray *)arrayFromIvarsProvider:(GBIvarsProvider *)provider;
+- (NSArray *)arrayFromMethodsProvider:(GBMethodsProvider *)provider;
+- (NSDictionary *)dictionaryFromMethod:(GBMethodData *)method;
+- (NSDictionary *)dictionaryFromArgument:(GBMethodArgument *)argument;
+- (void)addCommonDataFromObject:(GBModelBase *)object toDictionary:(NSMutableDictionary *)dictionary;
+
+@end
+
+@interface GBParserCache (Decoding)
+
+- (GBClassData *)classFromDictionary:(NSDictionary *)dictionary;
+- (GBCategoryData *)categoryFromDictionary:(NSDictionary *)dictionary;
+- (GBProtocolData *)protocolFromDictionary:(NSDictionary *)dictionary;
+- (void)registerProtocolsFromArray:(NSArray *)array toProvider:(GBAdoptedProtocolsProvider *)provider;
+- (void)registerIvarsFromArray:(NSArray *)array toProvider:(GBIvarsProvider *)provider;
+- (void)registerMethodsFromArray:(NSArray *)array toProvider:(GBMethodsProvider *)provider;
+- (GBMethodData *)methodFromDictionary:(NSDictionary *)dictionary;
+- (GBMethodArgument *)argumentFromDictionary:(NSDictionary *)dictionary;
+- (void)registerCommonDataFromDictionary:(NSDictionary *)dictionary toObject:(GBModelBase *)object;
+
+@end
+
+#pragma mark -
+
+@implementation GBParserCache
+
+#pragma mark Initialization & disposal
+
++ (id)cacheWithSettingsProvider:(id)settingsProvider {
+	return [[[self alloc] initWithSettingsProvider:settingsProvider] autorelease];
+}
+
+- (id)initWithSettingsProvider:(id)settingsProvider {
+	NSParameterAssert(settingsProvider != nil);
+	GBLogDebug(@"Initializing parser cache with settings provider %@...", settingsProvider);
+	self = [super init];
+	if (self) {
+		self.settings = settingsProvider;
+		_entries = [[NSDictionary alloc] init];
+		_updatedEntries = [[NSMutableDictionary alloc] init];
+	}
+	return self;
+}
+
+#pragma mark Persistence handling
+
+- (void)loadFromFile:(NSString *)path {
+	GBLogVerbose(@"Loading parser cache from '%@'...", path);
+	NSString *standardized = [path stringByStandardizingPath];
+	NSDictionary *entries = nil;
+	NSData *data = [NSData dataWithContentsOfFile:standardized];
+	if (data) {
+		NSError *error = nil;
+		NSDictionary *cache = [NSPropertyListSerialization propertyListWithData:data options:NSPropertyListImmutable format:NULL error:&error];
+		if (!cache) {
+			GBLogWarn(@"Failed reading parser cache from '%@', ignoring it!", path);
+		} else if (![[cache objectForKey:kGBCacheVersionKey] isEqualToString:self.cacheVersion]) {
+			GBLogVerbose(@"Parser cache was created by different appledoc version, ignoring it.");
+		} else {
+			entries = [cache objectForKey:kGBCacheEntriesKey];
+		}
+	}
+	@synchronized(self) {
+		[_entries release];
+		_entries = entries ? [entries retain] : [[NSDictionary alloc] init];
+		[_updatedEntries removeAllObjects];
+		self.numberOfHits = 0;
+		self.numberOfMisses = 0;
+	}
+}
+
+- (BOOL)writeToFile:(NSString *)path error:(NSError **)error {
+	GBLogVerbose(@"Writting parser cache to '%@'...", path);
+	NSData *data = nil;
+	@synchronized(self) {
+		NSMutableDictionary *cache = [NSMutableDictionary dictionaryWithCapacity:2];
+		[cache setObject:self.cacheVersion forKey:kGBCacheVersionKey];
+		[cache setObject:_updatedEntries forKey:kGBCacheEntriesKey];
+		data = [NSPropertyListSerialization dataWithPropertyList:cache format:NSPropertyListBinaryFormat_v1_0 options:0 error:error];
+	}
+	if (!data) return NO;
+
+	NSString *standardized = [path stringByStandardizingPath];
+	NSString *directory = [standardized stringByDeletingLastPathComponent];
+	if (![[NSFileManager defaultManager] createDirectoryAtPath:directory withIntermediateDirectories:YES attributes:nil error:error]) return NO;
+	return [data writeToFile:standardized options:NSDataWritingAtomic error:error];
+}
+
+#pragma mark Cache handling
+
+- (BOOL)registerObjectsForFile:(NSString *)path data:(NSData *)data toStore:(GBStore *)store {
+	NSParameterAssert(path != nil);
+	NSParameterAssert(data != nil);
+	NSParameterAssert(store != nil);
+	NSString *hash = [self hashFromData:data];
+	NSDictionary *entry = nil;
+	@synchronized(self) {
+		entry = [_entries objectForKey:path];
+		if (![[entry objectForKey:kGBEntryHashKey] isEqualToString:hash]) {
+			self.numberOfMisses++;
+			return NO;
+		}
+		[_updatedEntries setObject:entry forKey:path];
+		self.numberOfHits++;
+	}
+
+	GBLogVerbose(@"Registering cached objects for '%@'...", path);
+	for (NSDictionary *dictionary in [entry objectForKey:kGBEntryClassesKey]) [store registerClass:[self classFromDictionary:dictionary]];
+	for (NSDictionary *dictionary in [entry objectForKey:kGBEntryCategoriesKey]) [store registerCategory:[self categoryFromDictionary:dictionary]];
+	for (NSDictionary *dictionary in [entry objectForKey:kGBEntryProtocolsKey]) [store registerProtocol:[self protocolFromDictionary:dictionary]];
+	return YES;
+}
+
+- (void)cacheObjectsFromStore:(GBStore *)store forFile:(NSString *)path data:(NSData *)data {
+	NSParameterAssert(store != nil);
+	NSParameterAssert(path != nil);
+	NSParameterAssert(data != nil);
+	GBLogDebug(@"Caching objects for '%@'...", path);
+	NSMutableArray *classes = [NSMutableArray arrayWithCapacity:[store.classes count]];
+	NSMutableArray *categories = [NSMutableArray arrayWithCapacity:[store.categories count]];
+	NSMutableArray *protocols = [NSMutableArray arrayWithCapacity:[store.protocols count]];
+	for (GBClassData *class in [store classesSortedByName]) [classes addObject:[self dictionaryFromClass:class]];
+	for (GBCategoryData *category in [store categoriesSortedByName]) [categories addObject:[self dictionaryFromCategory:category]];
+	for (GBProtocolData *protocol in [store protocolsSortedByName]) [protocols addObject:[self dictionaryFromProtocol:protocol]];
+
+	NSMutableDictionary *entry = [NSMutableDictionary dictionaryWithCapacity:4];
+	[entry setObject:[self hashFromData:data] forKey:kGBEntryHashKey];
+	[entry setObject:classes forKey:kGBEntryClassesKey];
+	[entry setObject:categories forKey:kGBEntryCategoriesKey];
+	[entry setObject:protocols forKey:kGBEntryProtocolsKey];
+	@synchronized(self) {
+		[_updatedEntries setObject:entry forKey:path];
+	}
+}
+
+#pragma mark Helper methods
+
+- (NSString *)hashFromData:(NSData *)data {
+	unsigned char digest[CC_SHA1_DIGEST_LENGTH];
+	CC_SHA1([data bytes], (CC_LONG)[data length], digest);
+	NSMutableString *result = [NSMutableString stringWithCapacity:CC_SHA1_DIGEST_LENGTH * 2];
+	for (NSUInteger i=0; i<CC_SHA1_DIGEST_LENGTH; i++) [result appendFormat:@"%02x", digest[i]];
+	return result;
+}
+
+- (NSString *)cacheVersion {
+	NSDictionary *appledocData = self.settings.stringTemplates.appledocData;
+	return [NSString stringWithFormat:@"%@-%@", [appledocData objectForKey:@"version"], [appledocData objectForKey:@"build"]];
+}
+
+#pragma mark Properties
+
+@synthesize numberOfHits;
+@synthesize numberOfMisses;
+@synthesize settings;
+
+@end
+
+#pragma mark -
+
+@implementation GBParserCache (Encoding)
+
+- (NSDictionary *)dictionaryFromClass:(GBClassData *)class {
+	NSMutableDictionary *result = [NSMutableDictionary dictionary];
+	[result setObject:class.nameOfClass forKey:@"name"];
+	if (class.nameOfSuperclass) [result setObject:class.nameOfSuperclass forKey:@"superclass"];
+	[result setObject:[self arrayFromProtocolsProvider:class.adoptedProtocols] forKey:@"protocols"];
+	[result setObject:[self arrayFromIvarsProvider:class.ivars] forKey:@"ivars"];
+	[result setObject:[self arrayFromMethodsProvider:class.methods] forKey:@"sections"];
+	[self addCommonDataFromObject:class toDictionary:result];
+	return result;
+}
+
+- (NSDictionary *)dictionaryFromCategory:(GBCategoryData *)category {
+	NSMutableDictionary *result = [NSMutableDictionary dictionary];
+	[result setObject:category.nameOfClass forKey:@"class"];
+	if (category.nameOfCategory) [result setObject:category.nameOfCategory forKey:@"name"];
+	[result setObject:[self arrayFromProtocolsProvider:category.adoptedProtocols] forKey:@"protocols"];
+	[result setObject:[self arrayFromMethodsProvider:category.methods] forKey:@"sections"];
+	[self addCommonDataFromObject:category toDictionary:result];
+	return result;
+}
+
+- (NSDictionary *)dictionaryFromProtocol:(GBProtocolData *)protocol {
+	NSMutableDictionary *result = [NSMutableDictionary dictionary];
+	[result setObject:protocol.nameOfProtocol forKey:@"name"];
+	[result setObject:[self arrayFromProtocolsProvider:protocol.adoptedProtocols] forKey:@"protocols"];
+	[result setObject:[self arrayFromMethodsProvider:protocol.methods] forKey:@"sections"];
+	[self addCommonDataFromObject:protocol toDictionary:result];
+	return result;
+}
+
+- (NSArray *)arrayFromProtocolsProvider:(GBAdoptedProtocolsProvider *)provider {
+	// Parser only assigns names to adopted protocols, so that's all we need to cache.
+	NSMutableArray *result = [NSMutableArray arrayWithCapacity:[provider.protocols count]];
+	for (GBProtocolData *protocol in [provider protocolsSortedByName]) [result addObject:protocol.nameOfProtocol];
+	return result;
+}
+
+- (NSArray *)arrayFromIvarsProvider:(GBIvarsProvider *)provider {
+	// Ivars are cached in the order of registration with all components as required by ivar data initializer.
+	NSMutableArray *result = [NSMutableArray arrayWithCapacity:[provider.ivars count]];
+	for (GBIvarData *ivar in provider.ivars) {
+		NSMutableDictionary *data = [NSMutableDictionary dictionary];
+		[data setObject:[ivar.ivarTypes arrayByAddingObject:ivar.nameOfIvar] forKey:@"components"];
+		[self addCommonDataFromObject:ivar toDictionary:data];
+		[result addObject:data];
+	}
+	return result;
+}
+
+- (NSArray *)arrayFromMethodsProvider:(GBMethodsProvider *)provider {
+	// Sections are cached in the order of registration, each with its methods, so we can replay registration when restoring.
+	NSMutableArray *result = [NSMutableArray arrayWithCapacity:[provider.sections count]];
+	for (GBMethodSectionData *section in provider.sections) {
+		NSMutableArray *methods = [NSMutableArray arrayWithCapacity:[section.methods count]];
+		for (GBMethodData *method in section.methods) [methods addObject:[self dictionaryFromMethod:method]];
+		NSMutableDictionary *data = [NSMutableDictionary dictionaryWithObject:methods forKey:@"methods"];
+		if (section.sectionName) [data setObject:section.sectionName forKey:@"name"];
+		[result addObject:data];
+	}
+	return result;
+}
+
+- (NSDictionary *)dictionaryFromMethod:(GBMethodData *)method {
+	NSMutableArray *arguments = [NSMutableArray arrayWithCapacity:[method.methodArguments count]];
+	for (GBMethodArgument *argument in method.methodArguments) [arguments addObject:[self dictionaryFromArgument:argument]];
+	NSMutableDictionary *result = [NSMutableDictionary dictionary];
+	[result setObject:[NSNumber numberWithUnsignedInteger:method.methodType] forKey:@"type"];
+	[result setObject:method.methodAttributes ? method.methodAttributes : [NSArray array] forKey:@"attributes"];
+	[result setObject:method.methodResultTypes forKey:@"result"];
+	[result setObject:arguments forKey:@"arguments"];
+	[result setObject:[NSNumber numberWithBool:method.isRequired] forKey:@"required"];
+	[self addCommonDataFromObject:method toDictionary:result];
+	return result;
+}
+
+- (NSDictionary *)dictionaryFromArgument:(GBMethodArgument *)argument {
+	NSMutableDictionary *result = [NSMutableDictionary dictionary];
+	[result setObject:argument.argumentName forKey:@"name"];
+	[result setObject:argument.argumentTypes forKey:@"types"];
+	if (argument.argumentVar) [result setObject:argument.argumentVar forKey:@"var"];
+	if (argument.isVariableArg) [result setObject:argument.terminationMacros forKey:@"macros"];
+	return result;
+}
+
+- (void)addCommonDataFromObject:(GBModelBase *)object toDictionary:(NSMutableDictionary *)dictionary {
+	NSMutableArray *infos = [NSMutableArray arrayWithCapacity:[object.sourceInfos count]];
+	for (GBSourceInfo *info in [object sourceInfosSortedByName]) {
+		[infos addObject:[NSArray arrayWithObjects:info.filename, [NSNumber numberWithUnsignedInteger:info.lineNumber], nil]];
+	}
+	[dictionary setObject:infos forKey:@"sources"];
+
+	// Comment string value and source info are optional, so handle them separately.
+	if (!object.comment) return;
+	NSMutableDictionary *comment = [NSMutableDictionary dictionaryWithCapacity:3];
+	if (object.comment.stringValue) [comment setObject:object.comment.stringValue forKey:@"value"];
+	if (object.comment.sourceInfo) {
+		[comment setObject:object.comment.sourceInfo.filename forKey:@"filename"];
+		[comment setObject:[NSNumber numberWithUnsignedInteger:object.comment.sourceInfo.lineNumber] forKey:@"line"];
+	}
+	[dictionary setObject:comment forKey:@"comment"];
+}
+
+@end
+
+#pragma mark -
+
+@implementation GBParserCache (Decoding)
+
+- (GBClassData *)classFromDictionary:(NSDictionary *)dictionary {
+	GBClassData *result = [GBClassData classDataWithName:[dictionary objectForKey:@"name"]];
+	result.nameOfSuperclass = [dictionary objectForKey:@"superclass"];
+	[self registerCommonDataFromDictionary:dictionary toObject:result];
+	[self registerProtocolsFromArray:[dictionary objectForKey:@"protocols"] toProvider:result.adoptedProtocols];
+	[self registerIvarsFromArray:[dictionary objectForKey:@"ivars"] toProvider:result.ivars];
+	[self registerMethodsFromArray:[dictionary objectForKey:@"sections"] toProvider:result.methods];
+	return result;
+}
+
+- (GBCategoryData *)categoryFromDictionary:(NSDictionary *)dictionary {
+	GBCategoryData *result = [GBCategoryData categoryDataWithName:[dictionary objectForKey:@"name"] className:[dictionary objectForKey:@"class"]];
+	[self registerCommonDataFromDictionary:dictionary toObject:result];
+	[self registerProtocolsFromArray:[dictionary objectForKey:@"protocols"] toProvider:result.adoptedProtocols];
+	[self registerMethodsFromArray:[dictionary objectForKey:@"sections"] toProvider:result.methods];
+	return result;
+}
+
+- (GBProtocolData *)protocolFromDictionary:(NSDictionary *)dictionary {
+	GBProtocolData *result = [GBProtocolData protocolDataWithName:[dictionary objectForKey:@"name"]];
+	[self registerCommonDataFromDictionary:dictionary toObject:result];
+	[self registerProtocolsFromArray:[dictionary objectForKey:@"protocols"] toProvider:result.adoptedProtocols];
+	[self registerMethodsFromArray:[dictionary objectForKey:@"sections"] toProvider:result.methods];
+	return result;
+}
+
+- (void)registerProtocolsFromArray:(NSArray *)array toProvider:(GBAdoptedProtocolsProvider *)provider {
+	for (NSString *name in array) [provider registerProtocol:[GBProtocolData protocolDataWithName:name]];
+}
+
+- (void)registerIvarsFromArray:(NSArray *)array toProvider:(GBIvarsProvider *)provider {
+	for (NSDictionary *data in array) {
+		GBIvarData *ivar = [GBIvarData ivarDataWithComponents:[data objectForKey:@"components"]];
+		[self registerCommonDataFromDictionary:data toObject:ivar];
+		[provider registerIvar:ivar];
+	}
+}
+
+- (void)registerMethodsFromArray:(NSArray *)array toProvider:(GBMethodsProvider *)provider {
+	for (NSDictionary *section in array) {
+		[provider registerSectionWithName:[section objectForKey:@"name"]];
+		for (NSDictionary *method in [section objectForKey:@"methods"]) [provider registerMethod:[self methodFromDictionary:method]];
+	}
+}
+
+- (GBMethodData *)methodFromDictionary:(NSDictionary *)dictionary {
+	NSMutableArray *arguments = [NSMutableArray array];
+	for (NSDictionary *argument in [dictionary objectForKey:@"arguments"]) [arguments addObject:[self argumentFromDictionary:argument]];
+	GBMethodType type = [[dictionary objectForKey:@"type"] unsignedIntegerValue];
+	NSArray *attributes = [dictionary objectForKey:@"attributes"];
+	NSArray *result = [dictionary objectForKey:@"result"];
+	GBMethodData *method = [[[GBMethodData alloc] initWithType:type attributes:attributes result:result arguments:arguments] autorelease];
+	[method setIsRequired:[[dictionary objectForKey:@"required"] boolValue]];
+	[self registerCommonDataFromDictionary:dictionary toObject:method];
+	return method;
+}
+
+- (GBMethodArgument *)argumentFromDictionary:(NSDictionary *)dictionary {
+	NSString *name = [dictionary objectForKey:@"name"];
+	NSArray *types = [dictionary objectForKey:@"types"];
+	NSString *var = [dictionary objectForKey:@"var"];
+	NSArray *macros = [dictionary objectForKey:@"macros"];
+	return [GBMethodArgument methodArgumentWithName:name types:types var:var terminationMacros:macros];
+}
+
+- (void)registerCommonDataFromDictionary:(NSDictionary *)dictionary toObject:(GBModelBase *)object {
+	for (NSArray *info in [dictionary objectForKey:@"sources"]) {
+		NSString *filename = [info objectAtIndex:0];
+		NSUInteger line = [[info objectAtIndex:1] unsignedIntegerValue];
+		[object registerSourceInfo:[GBSourceInfo infoWithFilename:filename lineNumber:line]];
+	}
+
+	NSDictionary *comment = [dictionary objectForKey:@"comment"];
+	if (!comment) return;
+	GBSourceInfo *info = nil;
+	NSString *filename = [comment objectForKey:@"filename"];
+	if (filename) info = [GBSourceInfo infoWithFilename:filename lineNumber:[[comment objectForKey:@"line"] unsignedIntegerValue]];
+	[object setComment:[GBComment commentWithStringValue:[comment objectForKey:@"value"] sourceInfo:info]];
+}
+
+@end
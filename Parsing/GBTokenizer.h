@@ -11,6 +11,7 @@
 
 @class GBSourceInfo;
 @class GBComment;
+@class GBLexer;
 
 /** Provides common methods for tokenizing input source strings.
  
@@ -57,6 +58,27 @@
  */
 - (id)initWithSourceTokenizer:(PKTokenizer *)tokenizer filename:(NSString *)filename;
 
+/** Returns initialized autoreleased instance using the given `GBLexer`.
+ 
+ @param lexer The lexer that already split the source into tokens.
+ @param filename The name of the file without path used for generating source info.
+ @return Returns initialized instance or `nil` if failed.
+ @exception NSException Thrown if the given lexer or filename is `nil` or filename is empty string.
+ @see initWithLexer:filename:
+ */
++ (id)tokenizerWithLexer:(GBLexer *)lexer filename:(NSString *)filename;
+
+/** Initializes tokenizer with the given `GBLexer`.
+ 
+ This is an alternative to `initWithSourceTokenizer:filename:` which uses native lexer instead of `PKTokenizer`. Token objects are only created for tokens the client actually inspects; skipping tokens and determining comments positions only uses lexer records. Source information for tokens is taken directly from lexer tokens, so there's no need to index lines of the input.
+ 
+ @param lexer The lexer that already split the source into tokens.
+ @param filename The name of the file without path that's the source for _lexer_'s input.
+ @return Returns initialized instance or `nil` if failed.
+ @exception NSException Thrown if the given lexer or filename is `nil` or filename is empty string.
+ */
+- (id)initWithLexer:(GBLexer *)lexer filename:(NSString *)filename;
+
 ///---------------------------------------------------------------------------------------
 /// @name Tokenizing handling
 ///---------------------------------------------------------------------------------------
@@ -70,7 +92,7 @@
 
 /** Returns the token by looking ahead the given number of tokens from current position.
  
- If offset "points" within a valid token, the token is returned, otherwise EOF token is	returned. Note that this method automatically skips any comment tokens and only counts actual language tokens.
+ If offset "points" within a valid token, the token is returned, otherwise EOF token is	returned. Note that this method automatically skips any comment tokens and only counts actual language tokens. As positions of all language tokens are determined when the tokenizer is initialized, this doesn't depend on the number of comment tokens in between.
  
  @param offset The offset from the current position.
  @return Returns the token at the given offset or EOF token if offset point after EOF.
@@ -110,6 +132,18 @@
  */
 - (void)consumeFrom:(NSString *)start to:(NSString *)end usingBlock:(void (^)(PKToken *token, BOOL *consume, BOOL *stop))block;
 
+/** Consumes all tokens of the current block up to its closing brace.
+ 
+ This is a faster alternative to sending `consumeTo:usingBlock:` with a block that only counts nested braces, useful for skipping code such as method implementations. The method assumes current token is the first token after block's opening brace. Nested blocks are skipped and consuming stops when the closing brace of the current block becomes the current token; the brace itself is not consumed. If the given end token is found before that, consuming stops after consuming the end token. If EOF is reached before that, consuming stops at the end of stream.
+ 
+ When using `GBLexer`, tokens are compared using lexer records only, so no token object is created for skipped tokens. Comments are handled exactly the same way as with `consume:` however: if there are comments in front of skipped tokens, `lastComment` and `previousComment` are updated as if tokens were consumed one by one.
+ 
+ @param end Ending token.
+ @exception NSException Thrown if the given end token is `nil`.
+ @see consumeTo:usingBlock:
+ */
+- (void)consumeBlockBodyTo:(NSString *)end;
+
 /** Specifies whether we're at EOF.
  
  @return Returns `YES` if we're at EOF, `NO` otherwise.
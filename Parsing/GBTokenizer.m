@@ -6,28 +6,54 @@
 //  Copyright (C) 2010, Gentle Bytes. All rights reserved.
 //
 
-#import "RegexKitLite.h"
 #import "PKToken+GBToken.h"
+#import "GBLineIndex.h"
 #import "GBSourceInfo.h"
 #import "GBComment.h"
+#import "GBLexer.h"
 #import "GBTokenizer.h"
 
+// Character classes used by comments scanner. Whitespace matches NSCharacterSet's whitespaceCharacterSet (tab and Unicode space separators), newline matches newlineCharacterSet and delimiter matches the characters appledoc recognizes in comment delimiter lines such as "/////" or "*-*-*-*".
+static inline BOOL GBIsCommentWhitespace(unichar c) {
+	if (c == ' ' || c == '\t') return YES;
+	if (c < 0xA0) return NO;
+	return (c == 0xA0 || c == 0x1680 || (c >= 0x2000 && c <= 0x200A) || c == 0x202F || c == 0x205F || c == 0x3000);
+}
+
+static inline BOOL GBIsCommentNewline(unichar c) {
+	return ((c >= 0x0A && c <= 0x0D) || c == 0x85 || c == 0x2028 || c == 0x2029);
+}
+
+static inline BOOL GBIsCommentDelimiter(unichar c) {
+	return (c > 0 && c < 0x80 && strchr("!@#$%^&*()_=+`~,<.>/?;:'\"-", c) != NULL);
+}
+
 @interface GBTokenizer ()
 
 - (BOOL)consumeComments;
 - (NSString *)commentValueFromString:(NSString *)value;
+- (NSString *)singleLineCommentValueFromString:(NSString *)string;
+- (NSString *)multiLineCommentValueFromString:(NSString *)string;
+- (void)setupWithFilename:(NSString *)filename;
 - (NSArray *)allTokensFromTokenizer:(PKTokenizer *)tokenizer;
+- (NSData *)codeTokenIndexesFromTokens:(NSArray *)tokens;
+- (NSData *)codeTokenIndexesFromLexer:(GBLexer *)lexer;
+- (NSUInteger)tokenIndexOfCodeToken:(NSUInteger)index;
+- (PKToken *)tokenAtIndex:(NSUInteger)index;
+- (BOOL)tokenAtIndex:(NSUInteger)index matchesString:(const char *)string;
+- (NSUInteger)endOffsetOfToken:(PKToken *)token;
 @property (retain) NSString *filename;
 @property (retain) NSString *input;
+@property (retain) GBLineIndex *lineIndex;
 @property (retain) NSArray *tokens;
-@property (assign) NSUInteger tokenIndex;
+@property (retain) GBLexer *lexer;
+@property (retain) NSData *codeTokenIndexes;
+@property (assign) NSUInteger codeTokensCount;
+@property (assign) NSUInteger codeTokenIndex;
 @property (retain) NSMutableString *lastCommentBuilder;
 @property (retain) NSMutableString *previousCommentBuilder;
 @property (retain) GBSourceInfo *lastCommentSourceInfo;
 @property (retain) GBSourceInfo *previousCommentSourceInfo;
-@property (retain) NSString *singleLineCommentRegex;
-@property (retain) NSString *multiLineCommentRegex;
-@property (retain) NSString *commentDelimiterRegex;
 
 @end
 
@@ -41,6 +67,10 @@
 	return [[[self alloc] initWithSourceTokenizer:tokenizer filename:filename] autorelease];
 }
 
++ (id)tokenizerWithLexer:(GBLexer *)lexer filename:(NSString *)filename {
+	return [[[self alloc] initWithLexer:lexer filename:filename] autorelease];
+}
+
 - (id)initWithSourceTokenizer:(PKTokenizer *)tokenizer filename:(NSString *)filename {
 	NSParameterAssert(tokenizer != nil);
 	NSParameterAssert(filename != nil);
@@ -48,47 +78,56 @@
 	GBLogDebug(@"Initializing tokenizer using %@...", tokenizer);
 	self = [super init];
 	if (self) {
-		self.singleLineCommentRegex = @"(?m-s:\\s*///(.*)$)";
-		self.multiLineCommentRegex = @"(?s:/\\*\\*(.*)\\*/)";
-		self.commentDelimiterRegex = @"^[!@#$%^&*()_=+`~,<.>/?;:'\"-]{3,}";
-		self.tokenIndex = 0;
-		self.lastCommentBuilder = [NSMutableString string];
-		self.previousCommentBuilder = [NSMutableString string];
-		self.filename = [filename lastPathComponent];
 		self.input = tokenizer.string;
+		self.lineIndex = [GBLineIndex indexWithString:self.input];
 		self.tokens = [self allTokensFromTokenizer:tokenizer];
-		[self consumeComments];
+		self.codeTokenIndexes = [self codeTokenIndexesFromTokens:self.tokens];
+		[self setupWithFilename:filename];
+	}
+	return self;
+}
+
+- (id)initWithLexer:(GBLexer *)lexer filename:(NSString *)filename {
+	NSParameterAssert(lexer != nil);
+	NSParameterAssert(filename != nil);
+	NSParameterAssert([filename length] > 0);
+	GBLogDebug(@"Initializing tokenizer using %@...", lexer);
+	self = [super init];
+	if (self) {
+		self.lexer = lexer;
+		self.codeTokenIndexes = [self codeTokenIndexesFromLexer:lexer];
+		[self setupWithFilename:filename];
 	}
 	return self;
 }
 
+- (void)setupWithFilename:(NSString *)filename {
+	// Common setup for both initializers; tokens and code token indexes must already be prepared.
+	self.codeTokenIndex = 0;
+	self.lastCommentBuilder = [NSMutableString string];
+	self.previousCommentBuilder = [NSMutableString string];
+	self.filename = [filename lastPathComponent];
+	self.codeTokensCount = [self.codeTokenIndexes length] / sizeof(NSUInteger) - 1;
+	[self consumeComments];
+}
+
 #pragma mark Tokenizing handling
 
 - (PKToken *)lookahead:(NSUInteger)offset {
-	NSUInteger delta = 0;
-	NSUInteger counter = 0;
-	while (counter <= offset) {
-		NSUInteger index = self.tokenIndex + delta;
-		if (index >= [self.tokens count]) return [PKToken EOFToken];
-		if ([[self.tokens objectAtIndex:index] isComment]) {
-			delta++;
-			continue;
-		}
-		delta++;
-		counter++;
-	}
-	return [self.tokens objectAtIndex:self.tokenIndex + delta - 1];
+	NSUInteger index = self.codeTokenIndex + offset;
+	if (index >= self.codeTokensCount) return [PKToken EOFToken];
+	return [self tokenAtIndex:[self tokenIndexOfCodeToken:index]];
 }
 
 - (PKToken *)currentToken {
 	if ([self eof]) return [PKToken EOFToken];
-	return [self.tokens objectAtIndex:self.tokenIndex];
+	return [self tokenAtIndex:[self tokenIndexOfCodeToken:self.codeTokenIndex]];
 }
 
 - (void)consume:(NSUInteger)count {
 	if (count == 0) return;
 	while (count > 0 && ![self eof]) {
-		self.tokenIndex++;
+		self.codeTokenIndex++;
 		[self consumeComments];
 		count--;
 	}
@@ -127,8 +166,39 @@
 	if ([[self currentToken] matches:end]) [self consume:1];
 }
 
+- (void)consumeBlockBodyTo:(NSString *)end {
+	// We work directly with code token indexes here to avoid creating tokens. We only need to handle comments if there are any tokens between two successive code tokens; in such case we let consumeComments do its work the same way consume: would. As consume: also clears comment source infos when there are no comments before the new current token, we do the same after the last step.
+	NSParameterAssert(end != nil);
+	const char *endString = [end UTF8String];
+	NSUInteger level = 1;
+	NSUInteger index = self.codeTokenIndex;
+	BOOL handledComments = YES;
+	while (index < self.codeTokensCount) {
+		NSUInteger tokenIndex = [self tokenIndexOfCodeToken:index];
+		BOOL isEnd = [self tokenAtIndex:tokenIndex matchesString:endString];
+		if (!isEnd) {
+			if ([self tokenAtIndex:tokenIndex matchesString:"{"])
+				level++;
+			else if ([self tokenAtIndex:tokenIndex matchesString:"}"] && --level == 0)
+				break;
+		}
+		index++;
+		handledComments = ([self tokenIndexOfCodeToken:index] > tokenIndex + 1);
+		if (handledComments) {
+			self.codeTokenIndex = index;
+			[self consumeComments];
+		}
+		if (isEnd) break;
+	}
+	self.codeTokenIndex = index;
+	if (!handledComments) {
+		self.previousCommentSourceInfo = nil;
+		self.lastCommentSourceInfo = nil;
+	}
+}
+
 - (BOOL)eof {
-	return (self.tokenIndex >= [self.tokens count]);
+	return (self.codeTokenIndex >= self.codeTokensCount);
 }
 
 #pragma mark Token information handling
@@ -139,31 +209,34 @@
 
 - (GBSourceInfo *)sourceInfoForToken:(PKToken *)token {
 	NSParameterAssert(token != nil);
-	NSUInteger lines = [self.input numberOfLinesInRange:NSMakeRange(0, [token offset])];
+	// Lexer tokens know their line; this also covers lexer offsets being in bytes instead of characters. Without line index (i.e. when using lexer), the only other token we can get is EOF, which is reported at the start of the file.
+	NSUInteger lines = 1;
+	if ([token isKindOfClass:[GBLexerToken class]])
+		lines = [(GBLexerToken *)token line];
+	else if (self.lineIndex)
+		lines = [self.lineIndex lineNumberAtOffset:[token offset]];
 	return [GBSourceInfo infoWithFilename:self.filename lineNumber:lines];
 }
 
 #pragma mark Comments handling
 
 - (BOOL)consumeComments {
-	// This method checks if current token is a comment and consumes all comments until non-comment token is detected or EOF reached. The result of the method is that current index is positioned on the first non-comment token. If current token is not comment, the method doesn't do anything, but simply returns NO to indicate it didn't find a comment and therefore it didn't move current token. This is also where we do initial comments handling such as removing starting and ending chars etc.
+	// This method handles all comments between previous and current code token. As comment tokens positions are known in advance, we can simply process tokens between the two indexes; if there are none, the method doesn't do anything, but simply returns NO to indicate it didn't find a comment. Note that trailing comments after last code token are also handled once EOF is reached. This is also where we do initial comments handling such as removing starting and ending chars etc.
 	self.previousCommentSourceInfo = nil;
 	self.lastCommentSourceInfo = nil;
-	if ([self eof]) return NO;
-	if (![[self currentToken] isComment]) return NO;
+	NSUInteger start = (self.codeTokenIndex > 0) ? [self tokenIndexOfCodeToken:self.codeTokenIndex - 1] + 1 : 0;
+	NSUInteger end = [self tokenIndexOfCodeToken:self.codeTokenIndex];
+	if (start >= end) return NO;
 
 	PKToken *startingPreviousToken = nil;
 	PKToken *startingLastToken = nil;
 	NSUInteger previousSingleLineEndOffset = 0;
-	while (![self eof] && [[self currentToken] isComment]) {
-		PKToken *token = [self currentToken];
-		NSString *value = nil;
+	for (NSUInteger index = start; index < end; index++) {
+		PKToken *token = [self tokenAtIndex:index];
+		NSString *value = [self singleLineCommentValueFromString:[token stringValue]];
 		
-		// Match single line comments. Note that we can simplify the code with assumption that there's only one single line comment per match. If regex finds more (should never happen though), we simply combine them together. Then we check if the comment is a continuation of previous single liner by testing the string offset. If so we group the values together, otherwise we create a new single line comment. Finally we remember current comment offset to allow grouping of next single line comment. CAUTION: this algorithm won't group comments unless they start at the beginning of the line!
-		NSArray *singleLiners = [[token stringValue] componentsMatchedByRegex:self.singleLineCommentRegex capture:1];
-		if ([singleLiners count] > 0) {
-			value = [NSString string];
-			for (NSString *match in singleLiners) value = [value stringByAppendingString:match];
+		// Match single line comments. Note that we can simplify the code with assumption that there's only one single line comment per token. If we find more (should never happen though), we simply combine them together. Then we check if the comment is a continuation of previous single liner by testing the string offset. If so we group the values together, otherwise we create a new single line comment. Finally we remember current comment offset to allow grouping of next single line comment. CAUTION: this algorithm won't group comments unless they start at the beginning of the line!
+		if (value) {
 			BOOL isContinuingPreviousSingleLiner = ([token offset] == previousSingleLineEndOffset + 1);
 			if (isContinuingPreviousSingleLiner) {
 				[self.lastCommentBuilder appendString:@"\n"];
@@ -173,13 +246,12 @@
 				[self.lastCommentBuilder setString:@""];
 				startingLastToken = token;
 			}
-			previousSingleLineEndOffset = [token offset] + [[token stringValue] length];
+			previousSingleLineEndOffset = [self endOffsetOfToken:token];
 		}
 		
-		// Match multiple line comments and only process last (in reality we should only have one comment in each mutliline comment token, but let's handle any strange cases graceosly). 
+		// Match multiple line comments (in reality we should only have one comment in each mutliline comment token, but let's handle any strange cases graceosly). 
 		else {
-			NSArray *multiLiners = [[token stringValue] componentsMatchedByRegex:self.multiLineCommentRegex capture:1];
-			value = [multiLiners lastObject];
+			value = [self multiLineCommentValueFromString:[token stringValue]];
 			[self.previousCommentBuilder setString:self.lastCommentBuilder];
 			startingPreviousToken = startingLastToken;
 			[self.lastCommentBuilder setString:@""];
@@ -189,7 +261,6 @@
 		// Append string value to current comment and proceed with next token.
 		value = [value stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
 		[self.lastCommentBuilder appendString:value];
-		self.tokenIndex++;
 	}
 	
 	if (startingPreviousToken) self.previousCommentSourceInfo = [self sourceInfoForToken:startingPreviousToken];
@@ -197,48 +268,94 @@
 	return YES;
 }
 
+- (NSString *)singleLineCommentValueFromString:(NSString *)string {
+	// For each line containing ///, takes the text following its first occurrence up to the end of the line and combines all such texts together. Returns nil if there's no /// in the string.
+	NSUInteger length = [string length];
+	NSMutableData *buffer = [NSMutableData dataWithLength:length * sizeof(unichar)];
+	unichar *chars = [buffer mutableBytes];
+	[string getCharacters:chars range:NSMakeRange(0, length)];
+	NSMutableString *result = nil;
+	NSUInteger start = 0;
+	while (start < length) {
+		NSUInteger end = start;
+		while (end < length && !GBIsCommentNewline(chars[end])) end++;
+		for (NSUInteger i = start; i + 2 < end; i++) {
+			if (chars[i] != '/' || chars[i + 1] != '/' || chars[i + 2] != '/') continue;
+			if (!result) result = [NSMutableString stringWithCapacity:end - i];
+			CFStringAppendCharacters((CFMutableStringRef)result, chars + i + 3, end - i - 3);
+			break;
+		}
+		start = end + 1;
+	}
+	return result;
+}
+
+- (NSString *)multiLineCommentValueFromString:(NSString *)string {
+	// Returns the text between the first /** and the last */ following it or empty string if there's no such text (for example with unterminated comment at the end of the file).
+	NSRange start = [string rangeOfString:@"/**"];
+	if (start.location == NSNotFound) return @"";
+	NSUInteger from = NSMaxRange(start);
+	NSRange end = [string rangeOfString:@"*/" options:NSBackwardsSearch range:NSMakeRange(from, [string length] - from)];
+	if (end.location == NSNotFound) return @"";
+	return [string substringWithRange:NSMakeRange(from, end.location - from)];
+}
+
 - (NSString *)commentValueFromString:(NSString *)value {
-	if ([value length] == 0) return nil;
-	NSArray *lines = [value componentsSeparatedByCharactersInSet:[NSCharacterSet newlineCharacterSet]];
-	NSMutableArray *comments = [NSMutableArray arrayWithCapacity:[lines count]];
+	// The string is handled in a single pass over its characters: first we determine the range of each line to use, then we check whether all lines start with * prefix and finally compose the result from the ranges. No intermediate strings are created.
+	NSUInteger length = [value length];
+	if (length == 0) return nil;
+	NSMutableData *buffer = [NSMutableData dataWithLength:length * sizeof(unichar)];
+	unichar *chars = [buffer mutableBytes];
+	[value getCharacters:chars range:NSMakeRange(0, length)];
+	NSMutableData *linesData = [NSMutableData dataWithCapacity:16 * sizeof(NSRange)];
 	
-	// First pass: removes delimiters. We simply detect 3+ delimiter chars in any combination. If removing delimiter yields empty line, discard it.
-	[lines enumerateObjectsUsingBlock:^(NSString *line, NSUInteger idx, BOOL *stop) {
-		NSString *stripped = [line stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
-		NSString *delimited = [stripped stringByReplacingOccurrencesOfRegex:self.commentDelimiterRegex withString:@""];
-		if ([stripped length] > [delimited length]) {
-			if ([delimited length] > 0) [comments addObject:delimited];
-			return;
-		}
-		[comments addObject:line];
-	}];
+	// First pass: split to lines and remove delimiters. We simply detect 3+ delimiter chars in any combination at the start of stripped line. If removing delimiter yields empty line, discard it, otherwise use the stripped line without delimiter.
+	NSUInteger lineStart = 0;
+	while (lineStart <= length) {
+		NSUInteger lineEnd = lineStart;
+		while (lineEnd < length && !GBIsCommentNewline(chars[lineEnd])) lineEnd++;
+		NSUInteger strippedStart = lineStart;
+		NSUInteger strippedEnd = lineEnd;
+		while (strippedStart < strippedEnd && GBIsCommentWhitespace(chars[strippedStart])) strippedStart++;
+		while (strippedEnd > strippedStart && GBIsCommentWhitespace(chars[strippedEnd - 1])) strippedEnd--;
+		NSUInteger delimitedStart = strippedStart;
+		while (delimitedStart < strippedEnd && GBIsCommentDelimiter(chars[delimitedStart])) delimitedStart++;
+		NSRange line = NSMakeRange(lineStart, lineEnd - lineStart);
+		if (delimitedStart - strippedStart >= 3) line = NSMakeRange(delimitedStart, strippedEnd - delimitedStart);
+		if (line.length > 0 || delimitedStart - strippedStart < 3) [linesData appendBytes:&line length:sizeof(NSRange)];
+		lineStart = lineEnd + 1;
+	}
+	NSRange *lines = [linesData mutableBytes];
+	NSUInteger count = [linesData length] / sizeof(NSRange);
 	
 	// If all lines start with a *, ignore the prefix. Note that we ignore first line as it can only contain /** and text! We also ignore last line as if it only contains */
-	NSString *prefixRegex = @"(?m:^\\s*\\*[ ]*)";
-	__block BOOL stripPrefix = ([comments count] > 1);
-	if (stripPrefix) {
-		[comments enumerateObjectsUsingBlock:^(NSString *line, NSUInteger idx, BOOL *stop) {
-			NSString *stripped = [line stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
-			if (idx == [comments count]-1 && [stripped length] == 0) {
-				return;
-			}
-			if (idx > 0 && ![stripped isMatchedByRegex:prefixRegex]) {
-				stripPrefix = NO;
-				*stop = YES;
-			}
-		}];
+	BOOL stripPrefix = (count > 1);
+	for (NSUInteger idx = 1; stripPrefix && idx < count; idx++) {
+		NSUInteger start = lines[idx].location;
+		NSUInteger end = NSMaxRange(lines[idx]);
+		while (start < end && GBIsCommentWhitespace(chars[start])) start++;
+		if (idx == count - 1 && start == end) break;
+		if (start == end || chars[start] != '*') stripPrefix = NO;
 	}
 	
-	// Finally remove common line prefix including all spaces and compose all objects into final comment.
-	NSCharacterSet *spacesSet = [NSCharacterSet characterSetWithCharactersInString:@" "];
-	NSMutableString *result = [NSMutableString stringWithCapacity:[value length]];
-	[comments enumerateObjectsUsingBlock:^(NSString *line, NSUInteger idx, BOOL *stop) {
-		if (stripPrefix)
-			line = [line stringByReplacingOccurrencesOfRegex:prefixRegex withString:@""];
-		line = [line stringByTrimmingCharactersInSet:spacesSet];
-		[result appendString:line];
-		if (idx < [comments count] - 1) [result appendString:@"\n"];
-	}];	
+	// Finally remove common line prefix including all spaces and compose all lines into final comment.
+	NSMutableString *result = [NSMutableString stringWithCapacity:length];
+	for (NSUInteger idx = 0; idx < count; idx++) {
+		NSUInteger start = lines[idx].location;
+		NSUInteger end = NSMaxRange(lines[idx]);
+		if (stripPrefix) {
+			NSUInteger prefixEnd = start;
+			while (prefixEnd < end && GBIsCommentWhitespace(chars[prefixEnd])) prefixEnd++;
+			if (prefixEnd < end && chars[prefixEnd] == '*') {
+				start = prefixEnd + 1;
+				while (start < end && chars[start] == ' ') start++;
+			}
+		}
+		while (start < end && chars[start] == ' ') start++;
+		while (end > start && chars[end - 1] == ' ') end--;
+		CFStringAppendCharacters((CFMutableStringRef)result, chars + start, end - start);
+		if (idx < count - 1) [result appendString:@"\n"];
+	}
 	
 	// If the result is empty string, return nil, otherwise return the comment string.
 	if ([result length] == 0) return nil;
@@ -278,20 +395,66 @@
 	return result;
 }
 
+- (NSData *)codeTokenIndexesFromTokens:(NSArray *)tokens {
+	// Prepares indexes of all non-comment tokens, followed by the number of all tokens as EOF sentinel. This allows lookahead and consuming with simple index arithmetic, while comments attached to a code token are all tokens between its index and index of previous code token.
+	NSMutableData *result = [NSMutableData dataWithCapacity:([tokens count] + 1) * sizeof(NSUInteger)];
+	[tokens enumerateObjectsUsingBlock:^(PKToken *token, NSUInteger idx, BOOL *stop) {
+		if ([token isComment]) return;
+		[result appendBytes:&idx length:sizeof(NSUInteger)];
+	}];
+	NSUInteger count = [tokens count];
+	[result appendBytes:&count length:sizeof(NSUInteger)];
+	return result;
+}
+
+- (NSData *)codeTokenIndexesFromLexer:(GBLexer *)lexer {
+	// Same as codeTokenIndexesFromTokens:, but only uses lexer records, so no token object is created.
+	NSUInteger count = lexer.numberOfTokens;
+	NSMutableData *result = [NSMutableData dataWithCapacity:(count + 1) * sizeof(NSUInteger)];
+	for (NSUInteger idx = 0; idx < count; idx++) {
+		if ([lexer recordAtIndex:idx].type == PKTokenTypeComment) continue;
+		[result appendBytes:&idx length:sizeof(NSUInteger)];
+	}
+	[result appendBytes:&count length:sizeof(NSUInteger)];
+	return result;
+}
+
+- (NSUInteger)tokenIndexOfCodeToken:(NSUInteger)index {
+	const NSUInteger *indexes = [self.codeTokenIndexes bytes];
+	return indexes[index];
+}
+
+- (PKToken *)tokenAtIndex:(NSUInteger)index {
+	if (self.lexer) return [self.lexer tokenAtIndex:index];
+	return [self.tokens objectAtIndex:index];
+}
+
+- (BOOL)tokenAtIndex:(NSUInteger)index matchesString:(const char *)string {
+	if (self.lexer) return [self.lexer matchesString:string atIndex:index];
+	return (strcmp([[[self.tokens objectAtIndex:index] stringValue] UTF8String], string) == 0);
+}
+
+- (NSUInteger)endOffsetOfToken:(PKToken *)token {
+	// Lexer offsets are in bytes, so we need to use byte length to get the end offset.
+	if ([token isKindOfClass:[GBLexerToken class]]) return [token offset] + [(GBLexerToken *)token byteLength];
+	return [token offset] + [[token stringValue] length];
+}
+
 #pragma mark Properties
 
 @synthesize filename;
 @synthesize input;
+@synthesize lineIndex;
 @synthesize tokens;
-@synthesize tokenIndex;
+@synthesize lexer;
+@synthesize codeTokenIndexes;
+@synthesize codeTokensCount;
+@synthesize codeTokenIndex;
 @synthesize lastComment;
 @synthesize lastCommentBuilder;
 @synthesize lastCommentSourceInfo;
 @synthesize previousComment;
 @synthesize previousCommentBuilder;
 @synthesize previousCommentSourceInfo;
-@synthesize singleLineCommentRegex;
-@synthesize multiLineCommentRegex;
-@synthesize commentDelimiterRegex;
 
 @end
@@ -0,0 +1,61 @@
+//
+//  GBCommentLineScanner.h
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/** Determines whether the given character is whitespace as matched by `\s` of comment components regular expressions (Unicode White_Space property). */
+static inline BOOL GBIsCommentLineWhitespace(unichar c) {
+	if (c == ' ' || (c >= 0x09 && c <= 0x0D)) return YES;
+	if (c < 0x85) return NO;
+	return (c == 0x85 || c == 0xA0 || c == 0x1680 || (c >= 0x2000 && c <= 0x200A) || c == 0x2028 || c == 0x2029 || c == 0x202F || c == 0x205F || c == 0x3000);
+}
+
+/** The kinds of comment lines recognized by `GBCommentLineScanner`. */
+enum {
+	GBCommentLineKindText,
+	GBCommentLineKindUnorderedList,
+	GBCommentLineKindOrderedList,
+	GBCommentLineKindWarning,
+	GBCommentLineKindBug,
+	GBCommentLineKindParameter,
+	GBCommentLineKindException,
+	GBCommentLineKindReturn,
+	GBCommentLineKindCrossReference,
+};
+typedef NSUInteger GBCommentLineKind;
+
+/** Describes components of a single comment line as determined by `GBCommentLineScanner`.
+
+ The kind tells which of the recognized markers or directives the line starts with. Example length is the length of example block prefix or 0 if the line isn't part of example block. Indent length is the length of list item indent and name the range of parameter or exception name. Description location is the index at which the text of list item, directive, warning or bug starts. Only the fields relevant for the kind of the line are set, the rest are zero.
+ */
+typedef struct {
+	GBCommentLineKind kind;
+	NSUInteger exampleLength;
+	NSUInteger indentLength;
+	NSRange name;
+	NSUInteger descriptionLocation;
+} GBCommentLine;
+
+/** Determines the kind and components of comment lines without using regular expressions.
+
+ The scanner recognizes the same syntax as the corresponding regular expressions from `GBCommentComponentsProvider`: example prefixes, ordered and unordered list items, `@warning`, `@bug`, `@param`, `@exception`, `@return`, `@returns`, `@see` and `@sa`. Lines are checked in a single pass over their characters, so `GBCommentsProcessor` can classify all lines of a comment once and then dispatch on the result.
+
+ The same method is also used for extracting components from multiple lines combined into a single string; in such case whitespace following list markers, directive keywords and names may span lines, the same as with regular expressions.
+ */
+@interface GBCommentLineScanner : NSObject
+
+/** Scans the given line or lines and returns its components.
+
+ Example prefix is detected independently of the kind of the line, as example block may contain any text. If the line doesn't start with any of the recognized markers or directives, `GBCommentLineKindText` is returned.
+
+ @param string The string to scan.
+ @return Returns components of the string.
+ */
++ (GBCommentLine)componentsOfLine:(NSString *)string;
+
+@end
@@ -0,0 +1,129 @@
+//
+//  GBCommentLineScanner.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBCommentLineScanner.h"
+
+static inline BOOL GBIsLineDigit(unichar c) {
+	return (c >= '0' && c <= '9');
+}
+
+// Directive keywords in the order they are tested; note that "return" needs to come before "returns" as the regex alternation does.
+static const struct {
+	const char *keyword;
+	GBCommentLineKind kind;
+	BOOL hasName;
+} GBCommentLineKeywords[] = {
+	{ "warning", GBCommentLineKindWarning, NO },
+	{ "bug", GBCommentLineKindBug, NO },
+	{ "param", GBCommentLineKindParameter, YES },
+	{ "exception", GBCommentLineKindException, YES },
+	{ "return", GBCommentLineKindReturn, NO },
+	{ "returns", GBCommentLineKindReturn, NO },
+	{ "see", GBCommentLineKindCrossReference, NO },
+	{ "sa", GBCommentLineKindCrossReference, NO },
+};
+
+@interface GBCommentLineScanner ()
+
++ (BOOL)scanListItemFromCharacters:(const unichar *)chars length:(NSUInteger)length toLine:(GBCommentLine *)line;
++ (BOOL)scanDirectiveFromCharacters:(const unichar *)chars length:(NSUInteger)length toLine:(GBCommentLine *)line;
+
+@end
+
+#pragma mark -
+
+@implementation GBCommentLineScanner
+
+#pragma mark Scanning
+
++ (GBCommentLine)componentsOfLine:(NSString *)string {
+	GBCommentLine result = { GBCommentLineKindText, 0, 0, { 0, 0 }, 0 };
+	NSUInteger length = [string length];
+	if (length == 0) return result;
+	unichar stackChars[256];
+	unichar *chars = (length <= 256) ? stackChars : malloc(length * sizeof(unichar));
+	[string getCharacters:chars range:NSMakeRange(0, length)];
+
+	// Example prefix is a tab optionally preceeded by a space or four spaces.
+	if (chars[0] == '\t')
+		result.exampleLength = 1;
+	else if (length >= 2 && chars[0] == ' ' && chars[1] == '\t')
+		result.exampleLength = 2;
+	else if (length >= 4 && chars[0] == ' ' && chars[1] == ' ' && chars[2] == ' ' && chars[3] == ' ')
+		result.exampleLength = 4;
+
+	// List items and directives are mutually exclusive: list marker needs to be followed by whitespace, while directive keyword follows the first non-whitespace character immediately.
+	if (![self scanListItemFromCharacters:chars length:length toLine:&result]) {
+		[self scanDirectiveFromCharacters:chars length:length toLine:&result];
+	}
+	if (chars != stackChars) free(chars);
+	return result;
+}
+
++ (BOOL)scanListItemFromCharacters:(const unichar *)chars length:(NSUInteger)length toLine:(GBCommentLine *)line {
+	// Indent consists of spaces and tabs only, followed by one of "-+*" or a number with a dot and at least one whitespace.
+	NSUInteger indent = 0;
+	while (indent < length && (chars[indent] == ' ' || chars[indent] == '\t')) indent++;
+	if (indent == length) return NO;
+
+	GBCommentLineKind kind;
+	NSUInteger index = indent;
+	unichar c = chars[index];
+	if (c == '-' || c == '+' || c == '*') {
+		kind = GBCommentLineKindUnorderedList;
+		index++;
+	} else if (GBIsLineDigit(c)) {
+		kind = GBCommentLineKindOrderedList;
+		while (index < length && GBIsLineDigit(chars[index])) index++;
+		if (index == length || chars[index] != '.') return NO;
+		index++;
+	} else {
+		return NO;
+	}
+	if (index == length || !GBIsCommentLineWhitespace(chars[index])) return NO;
+	while (index < length && GBIsCommentLineWhitespace(chars[index])) index++;
+
+	line->kind = kind;
+	line->indentLength = indent;
+	line->descriptionLocation = index;
+	return YES;
+}
+
++ (BOOL)scanDirectiveFromCharacters:(const unichar *)chars length:(NSUInteger)length toLine:(GBCommentLine *)line {
+	// Directive starts with optional whitespace, followed by any single character (usually @ or \) and keyword. Keyword needs to be followed by whitespace; parameters and exceptions also require a name followed by whitespace.
+	NSUInteger index = 0;
+	while (index < length && GBIsCommentLineWhitespace(chars[index])) index++;
+	if (index == length) return NO;
+	index += (CFStringIsSurrogateHighCharacter(chars[index]) && index + 1 < length && CFStringIsSurrogateLowCharacter(chars[index + 1])) ? 2 : 1;
+
+	NSUInteger count = sizeof(GBCommentLineKeywords) / sizeof(GBCommentLineKeywords[0]);
+	for (NSUInteger i=0; i<count; i++) {
+		const char *keyword = GBCommentLineKeywords[i].keyword;
+		NSUInteger keywordLength = strlen(keyword);
+		if (index + keywordLength >= length) continue;
+		NSUInteger j = 0;
+		while (j < keywordLength && chars[index + j] == (unichar)keyword[j]) j++;
+		if (j < keywordLength || !GBIsCommentLineWhitespace(chars[index + keywordLength])) continue;
+
+		NSUInteger location = index + keywordLength;
+		while (location < length && GBIsCommentLineWhitespace(chars[location])) location++;
+		if (GBCommentLineKeywords[i].hasName) {
+			NSUInteger nameStart = location;
+			while (location < length && !GBIsCommentLineWhitespace(chars[location])) location++;
+			if (location == nameStart || location == length) return NO;
+			line->name = NSMakeRange(nameStart, location - nameStart);
+			while (location < length && GBIsCommentLineWhitespace(chars[location])) location++;
+		}
+		line->kind = GBCommentLineKeywords[i].kind;
+		line->descriptionLocation = location;
+		return YES;
+	}
+	return NO;
+}
+
+@end
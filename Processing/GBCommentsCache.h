@@ -0,0 +1,89 @@
+//
+//  GBCommentsCache.h
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GBStore;
+@class GBComment;
+
+/** Memoizes comments processed by `GBCommentsProcessor` within a single processing run.
+
+ Many comments are processed with exactly the same text: documentation copied from superclass or adopted protocol methods and boilerplate comments repeated over many methods. Processed comment only depends on its text and on the context used for resolving links, so the cache remembers processed paragraphs, parameters, result, exceptions and cross references for each text and registers the same objects to further comments instead of processing them again. Processed objects are never changed afterwards, so they can be shared between comments.
+
+ Comments processor tells the cache whether processed data depends on the context. That's the case whenever a link to an object or member was created or a local member was tested, as these are resolved and referenced relative to the context; such data is only shared with comments processed within the same context. All other data is shared with any context, except that data processed without context is only shared with comments processed without context, as local members are never tested for these. Note that objects are only removed from the store while processing, so a link that couldn't be resolved can't become valid later on.
+
+ The class is thread safe, so it can be shared by concurrent processing workers.
+ */
+@interface GBCommentsCache : NSObject {
+	@private
+	GBStore *_store;
+	NSMutableDictionary *_entries;
+	NSUInteger _numberOfHits;
+	NSUInteger _numberOfMisses;
+}
+
+///---------------------------------------------------------------------------------------
+/// @name Initialization & disposal
+///---------------------------------------------------------------------------------------
+
+/** Returns autoreleased cache for comments processed against the given store.
+
+ @param store The store comments are processed against.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given store is `nil`.
+ */
++ (id)cacheWithStore:(GBStore *)store;
+
+/** Initializes the cache for comments processed against the given store.
+
+ This is the designated initializer.
+
+ @param store The store comments are processed against.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given store is `nil`.
+ */
+- (id)initWithStore:(GBStore *)store;
+
+///---------------------------------------------------------------------------------------
+/// @name Cache handling
+///---------------------------------------------------------------------------------------
+
+/** Registers cached processed data for the text of the given comment to the comment if available.
+
+ If data was cached for the same text and is valid for the given context, all cached paragraphs, parameters, result, exceptions and cross references are registered to the comment and `numberOfHits` is incremented. Otherwise nothing is registered and `numberOfMisses` is incremented.
+
+ @param comment The comment to register processed data to.
+ @param context The context in which the comment is processed or `nil`.
+ @return Returns `YES` if processed data was registered from cache, `NO` if the comment needs to be processed.
+ @exception NSException Thrown if the given comment is `nil`.
+ @see cacheProcessedDataFromComment:context:dependsOnContext:
+ */
+- (BOOL)registerProcessedDataToComment:(GBComment *)comment context:(id)context;
+
+/** Caches processed data of the given comment.
+
+ The comment should be processed just before sending this message, so that the cache takes processed data before it's changed by `GBProcessor`. Any previously cached data for the same text and context is replaced.
+
+ @param comment The processed comment.
+ @param context The context in which the comment was processed or `nil`.
+ @param dependsOnContext `YES` if processed data is only valid for the given context, `NO` otherwise.
+ @exception NSException Thrown if the given comment is `nil`.
+ @see registerProcessedDataToComment:context:
+ */
+- (void)cacheProcessedDataFromComment:(GBComment *)comment context:(id)context dependsOnContext:(BOOL)dependsOnContext;
+
+/** The store this cache was created for. */
+@property (readonly) GBStore *store;
+
+/** The number of comments whose processed data was registered from cache. */
+@property (readonly) NSUInteger numberOfHits;
+
+/** The number of comments which weren't found in cache. */
+@property (readonly) NSUInteger numberOfMisses;
+
+@end
@@ -0,0 +1,134 @@
+//
+//  GBCommentsCache.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBStore.h"
+#import "GBDataObjects.h"
+#import "GBCommentsCache.h"
+
+static NSString *kGBEntryCommentKey = @"comment";
+static NSString *kGBEntryContextKey = @"context";
+static NSString *kGBEntryHasContextKey = @"hasContext";
+
+@interface GBCommentsCache ()
+
+- (NSUInteger)indexOfEntryInArray:(NSArray *)entries forContext:(id)context dependsOnContext:(BOOL)dependsOnContext;
+- (void)registerProcessedDataFromComment:(GBComment *)source toComment:(GBComment *)destination;
+@property (readwrite, assign) NSUInteger numberOfHits;
+@property (readwrite, assign) NSUInteger numberOfMisses;
+
+@end
+
+#pragma mark -
+
+@implementation GBCommentsCache
+
+#pragma mark Initialization & disposal
+
++ (id)cacheWithStore:(GBStore *)store {
+	return [[[self alloc] initWithStore:store] autorelease];
+}
+
+- (id)initWithStore:(GBStore *)store {
+	NSParameterAssert(store != nil);
+	GBLogDebug(@"Initializing comments cache for %@...", store);
+	self = [super init];
+	if (self) {
+		_store = [store retain];
+		_entries = [[NSMutableDictionary alloc] init];
+	}
+	return self;
+}
+
+- (void)dealloc {
+	[_store release];
+	[_entries release];
+	[super dealloc];
+}
+
+#pragma mark Cache handling
+
+- (BOOL)registerProcessedDataToComment:(GBComment *)comment context:(id)context {
+	NSParameterAssert(comment != nil);
+	GBComment *cached = nil;
+	@synchronized(self) {
+		// Data that depends on the context is preferred, but there can only be one kind of entry for the same text and context, as processing always gives the same result.
+		NSArray *entries = [_entries objectForKey:comment.stringValue];
+		NSUInteger index = [self indexOfEntryInArray:entries forContext:context dependsOnContext:YES];
+		if (index == NSNotFound) index = [self indexOfEntryInArray:entries forContext:context dependsOnContext:NO];
+		if (index == NSNotFound) {
+			self.numberOfMisses++;
+			return NO;
+		}
+		// Another worker may replace the entry once we leave the lock, so keep the cached comment alive while we register its data.
+		cached = [[[[entries objectAtIndex:index] objectForKey:kGBEntryCommentKey] retain] autorelease];
+		self.numberOfHits++;
+	}
+	GBLogDebug(@"Registering processed data for %@ from cache...", comment);
+	[self registerProcessedDataFromComment:cached toComment:comment];
+	return YES;
+}
+
+- (void)cacheProcessedDataFromComment:(GBComment *)comment context:(id)context dependsOnContext:(BOOL)dependsOnContext {
+	NSParameterAssert(comment != nil);
+	// Processed data is copied to a comment owned by the cache; GBProcessor reorders parameters of the processed comment, so we can't keep the comment itself.
+	GBComment *cached = [GBComment commentWithStringValue:comment.stringValue];
+	[self registerProcessedDataFromComment:comment toComment:cached];
+	if (!context) dependsOnContext = NO;
+	NSDictionary *entry = [NSDictionary dictionaryWithObjectsAndKeys:
+		cached, kGBEntryCommentKey,
+		dependsOnContext ? context : [NSNull null], kGBEntryContextKey,
+		[NSNumber numberWithBool:(context != nil)], kGBEntryHasContextKey,
+		nil];
+	@synchronized(self) {
+		NSMutableArray *entries = [_entries objectForKey:comment.stringValue];
+		if (!entries) {
+			entries = [NSMutableArray arrayWithCapacity:1];
+			[_entries setObject:entries forKey:comment.stringValue];
+		}
+		NSUInteger index = [self indexOfEntryInArray:entries forContext:context dependsOnContext:dependsOnContext];
+		if (index != NSNotFound)
+			[entries replaceObjectAtIndex:index withObject:entry];
+		else
+			[entries addObject:entry];
+	}
+}
+
+#pragma mark Helper methods
+
+- (NSUInteger)indexOfEntryInArray:(NSArray *)entries forContext:(id)context dependsOnContext:(BOOL)dependsOnContext {
+	// Entries that depend on the context are matched by context identity, others by whether they were processed with any context at all.
+	BOOL hasContext = (context != nil);
+	if (!hasContext) dependsOnContext = NO;
+	for (NSUInteger i=0; i<[entries count]; i++) {
+		NSDictionary *entry = [entries objectAtIndex:i];
+		id entryContext = [entry objectForKey:kGBEntryContextKey];
+		if (dependsOnContext) {
+			if (entryContext == context) return i;
+		} else if (entryContext == [NSNull null] && [[entry objectForKey:kGBEntryHasContextKey] boolValue] == hasContext) {
+			return i;
+		}
+	}
+	return NSNotFound;
+}
+
+- (void)registerProcessedDataFromComment:(GBComment *)source toComment:(GBComment *)destination {
+	// Note that description paragraphs are prepared by GBProcessor after processing, depending on the object, so they are not part of processed data.
+	for (GBCommentParagraph *paragraph in source.paragraphs) [destination registerParagraph:paragraph];
+	for (GBCommentArgument *parameter in source.parameters) [destination registerParameter:parameter];
+	if (source.result) [destination registerResult:source.result];
+	for (GBCommentArgument *exception in source.exceptions) [destination registerException:exception];
+	for (GBParagraphLinkItem *crossref in source.crossrefs) [destination registerCrossReference:crossref];
+}
+
+#pragma mark Properties
+
+@synthesize store = _store;
+@synthesize numberOfHits = _numberOfHits;
+@synthesize numberOfMisses = _numberOfMisses;
+
+@end
@@ -10,6 +10,9 @@
 
 @protocol GBObjectDataProviding;
 @class GBComment;
+@class GBSymbolIndex;
+@class GBCrossReferenceMatcher;
+@class GBCommentsCache;
 
 /** Implements comments processing.
  
@@ -70,4 +73,22 @@
  */
 - (void)processComment:(GBComment *)comment withStore:(id)store;
 
+/** The `GBSymbolIndex` used for resolving cross references to objects.
+ 
+ If the index is not assigned or was built for a different store than the one passed to `processComment:withContext:store:`, a new index is built for the given store automatically. `GBProcessor` assigns the index it maintains while processing the store, so the index is built only once and reflects objects removed during processing.
+ */
+@property (retain) GBSymbolIndex *symbolIndex;
+
+/** The `GBCrossReferenceMatcher` used for detecting cross references in comment text.
+ 
+ If the matcher is not assigned or was built for a different store than the one passed to `processComment:withContext:store:`, a new matcher is built for the given store automatically. `GBProcessor` assigns the matcher it builds for the store, so the matcher is built only once and shared by all comments processors. Candidates found by the matcher are resolved through `symbolIndex`.
+ */
+@property (retain) GBCrossReferenceMatcher *crossReferenceMatcher;
+
+/** The `GBCommentsCache` used for memoizing processed comments or `nil` if comments shouldn't be memoized.
+
+ If assigned and created for the same store as the one passed to `processComment:withContext:store:`, processed data is registered from the cache for comments whose text was already processed in compatible context, otherwise the comment is processed and its data cached. Comments whose processing emits warnings are not cached, so that each location is reported. `GBProcessor` assigns the cache it creates for the store, so it's shared by all comments processors; by default no cache is used.
+ */
+@property (retain) GBCommentsCache *commentsCache;
+
 @end
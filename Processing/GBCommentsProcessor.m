@@ -6,34 +6,65 @@
 //  Copyright (C) 2010, Gentle Bytes. All rights reserved.
 //
 
-#import "RegexKitLite.h"
 #import "GBApplicationSettingsProvider.h"
 #import "GBStore.h"
+#import "GBSymbolIndex.h"
 #import "GBDataObjects.h"
+#import "GBProfiler.h"
+#import "GBCommentLineScanner.h"
+#import "GBCrossReferenceMatcher.h"
+#import "GBCommentsCache.h"
 #import "GBCommentsProcessor.h"
 
+// Inline markup recognized within comment text; bold-italics is marked with either "*_" or "_*".
+enum {
+	GBInlineMarkupNone,
+	GBInlineMarkupBold,
+	GBInlineMarkupItalics,
+	GBInlineMarkupBoldItalics,
+	GBInlineMarkupCode,
+	GBInlineMarkupCount
+};
+typedef NSUInteger GBInlineMarkup;
+
+// Warns about the comment being processed. Warnings refer to the location of the comment, so such comments are not cached; each copy reports its own location.
+#define GBLogCommentWarn(frmt, ...) do { self.currentCommentReportedWarnings = YES; GBLogWarn(frmt, ##__VA_ARGS__); } while(0)
+
+static inline GBInlineMarkup GBInlineMarkupAtIndex(const unichar *chars, NSUInteger index, NSUInteger length, NSUInteger *markerLength) {
+	// Returns the markup whose marker starts at the given index and its length. Note that "*_" and "_*" are always taken as bold-italics marker, so markers need to be taken from left to right; for example "*_*" is bold-italics marker followed by bold one.
+	unichar c = chars[index];
+	*markerLength = 1;
+	if (c == '`') return GBInlineMarkupCode;
+	if (c != '*' && c != '_') return GBInlineMarkupNone;
+	if (index + 1 < length && chars[index + 1] == ((c == '*') ? '_' : '*')) {
+		*markerLength = 2;
+		return GBInlineMarkupBoldItalics;
+	}
+	return (c == '*') ? GBInlineMarkupBold : GBInlineMarkupItalics;
+}
+
 @interface GBCommentsProcessor ()
 
 - (BOOL)findCommentBlockInLines:(NSArray *)lines blockRange:(NSRange *)range;
 - (void)processCommentBlockInLines:(NSArray *)lines blockRange:(NSRange)range;
 
-- (BOOL)registerWarningBlockFromlines:(NSArray *)lines;
-- (BOOL)registerBugBlockFromLines:(NSArray *)lines;
-- (BOOL)registerExampleBlockFromLines:(NSArray *)lines;
-- (BOOL)registerListBlockFromLines:(NSArray *)lines;
-- (BOOL)registerDirectivesBlockFromLines:(NSArray *)lines;
+- (void)registerWarningBlockFromLines:(NSArray *)lines;
+- (void)registerBugBlockFromLines:(NSArray *)lines;
+- (void)registerExampleBlockFromLines:(NSArray *)lines components:(const GBCommentLine *)components;
+- (void)registerListBlockFromLines:(NSArray *)lines components:(const GBCommentLine *)components;
+- (BOOL)registerDirectivesBlockFromLines:(NSArray *)lines components:(const GBCommentLine *)components;
 - (void)registerTextBlockFromLines:(NSArray *)lines;
 
 - (void)registerTextItemsFromStringToCurrentParagraph:(NSString *)string;
-- (void)registerTextAndLinkItemsFromString:(NSString *)string toObject:(id)object;
+- (void)registerDecoratorItemWithMarkup:(GBInlineMarkup)markup fromCharacters:(const unichar *)chars range:(NSRange)range ofString:(NSString *)string toParagraph:(GBCommentParagraph *)paragraph;
+- (void)registerTextAndLinkItemsFromCharacters:(const unichar *)chars range:(NSRange)range ofString:(NSString *)string toObject:(id)object;
 
 - (id)linkItemFromString:(NSString *)string range:(NSRange *)range description:(NSString **)description;
-- (id)remoteMemberLinkItemFromString:(NSString *)string range:(NSRange *)range;
-- (id)localMemberLinkFromString:(NSString *)string range:(NSRange *)range;
-- (id)classLinkFromString:(NSString *)string range:(NSRange *)range;
-- (id)categoryLinkFromString:(NSString *)string range:(NSRange *)range;
-- (id)protocolLinkFromString:(NSString *)string range:(NSRange *)range;
-- (id)urlLinkItemFromString:(NSString *)string range:(NSRange *)range;
+- (id)linkItemAtIndex:(NSUInteger)index ofCharacters:(const unichar *)chars length:(NSUInteger)length string:(NSString *)string range:(NSRange *)range description:(NSString **)description;
+- (id)remoteMemberLinkItemWithObjectName:(NSString *)objectName memberName:(NSString *)memberName linkText:(NSString *)linkText;
+- (id)localMemberLinkItemWithSelector:(NSString *)selector;
+- (id)objectLinkItemWithName:(NSString *)name object:(id)object;
+- (id)urlLinkItemWithAddress:(NSString *)address;
 
 - (GBCommentParagraph *)pushParagraphIfStackIsEmpty;
 - (GBCommentParagraph *)pushParagraph:(BOOL)canAutoRegister;
@@ -42,12 +73,14 @@
 - (void)popAllParagraphs;
 
 @property (retain) NSMutableArray *paragraphsStack;
+@property (retain) NSData *currentLinesComponents;
 @property (retain) GBComment *currentComment;
 @property (retain) id currentContext;
+@property (assign) BOOL currentCommentDependsOnContext;
+@property (assign) BOOL currentCommentReportedWarnings;
 
 @property (retain) GBStore *store;
 @property (retain) GBApplicationSettingsProvider *settings;
-@property (readonly) GBCommentComponentsProvider *components;
 
 @property (readonly) NSString *sourceFileInfo;
 @property (assign) NSUInteger currentStartLine;
@@ -87,17 +120,41 @@
 	self.paragraphsStack = [NSMutableArray array];
 	self.currentComment = comment;
 	self.currentContext = context;
-	self.store = store;	
+	self.store = store;
+	if (self.symbolIndex.store != store) self.symbolIndex = [GBSymbolIndex indexWithStore:store];
+	if (self.crossReferenceMatcher.store != store) self.crossReferenceMatcher = [GBCrossReferenceMatcher matcherWithStore:store];
+	
+	// If the same text was already processed in compatible context, share processed data. Contexts unknown to cross reference matcher test every word as local member, so we don't cache comments processed within them.
+	GBCommentsCache *cache = (self.commentsCache.store == store) ? self.commentsCache : nil;
+	if (context && ![self.crossReferenceMatcher knowsSelectorsOfContext:context]) cache = nil;
+	if ([cache registerProcessedDataToComment:comment context:context]) {
+		GBLogDebug(@"- Comment was already processed, using cached data.");
+		GBProfileCount(@"cachedComments", 1);
+		return;
+	}
+	GBProfileCount(@"processedComments", 1);
+	self.currentCommentDependsOnContext = NO;
+	self.currentCommentReportedWarnings = NO;
+	
 	NSArray *lines = [comment.stringValue arrayOfLines];
 	NSUInteger line = comment.sourceInfo.lineNumber;
 	NSRange range = NSMakeRange(0, 0);
 	GBLogDebug(@"- Comment has %lu lines.", [lines count]);
+	
+	// Classify all lines once up front, block handlers only dispatch on the kinds of their lines.
+	NSMutableData *components = [NSMutableData dataWithLength:[lines count] * sizeof(GBCommentLine)];
+	GBCommentLine *component = [components mutableBytes];
+	for (NSString *string in lines) *component++ = [GBCommentLineScanner componentsOfLine:string];
+	self.currentLinesComponents = components;
+	
 	while ([self findCommentBlockInLines:lines blockRange:&range]) {
 		GBLogDebug(@"- Found comment block in lines %lu..%lu...", line + range.location, line + range.location + range.length);
 		[self processCommentBlockInLines:lines blockRange:range];
 		range.location += range.length;
 	}
 	[self popAllParagraphs];
+	self.currentLinesComponents = nil;
+	if (!self.currentCommentReportedWarnings) [cache cacheProcessedDataFromComment:comment context:context dependsOnContext:self.currentCommentDependsOnContext];
 }
 
 - (BOOL)findCommentBlockInLines:(NSArray *)lines blockRange:(NSRange *)range {
@@ -131,14 +188,35 @@
 - (void)processCommentBlockInLines:(NSArray *)lines blockRange:(NSRange)range {
 	// The given range is guaranteed to point to actual block within the lines array, so we only need to determine the kind of block and how to handle it.
 	NSArray *block = [lines subarrayWithRange:range];
+	const GBCommentLine *components = (const GBCommentLine *)[self.currentLinesComponents bytes] + range.location;
 	self.currentStartLine = self.currentComment.sourceInfo.lineNumber + range.location;
 	
-	// If the block defines one of the known paragraph items, register it and return. Note that paragraph items are simply added to previous paragraph, however if no paragraph exists yet, this will automatically create one.
-	if ([self registerExampleBlockFromLines:block]) return;
-	if ([self registerBugBlockFromLines:block]) return;
-	if ([self registerWarningBlockFromlines:block]) return;
-	if ([self registerListBlockFromLines:block]) return;
-	if ([self registerDirectivesBlockFromLines:block]) return;
+	// If the block defines one of the known paragraph items, register it and return. Note that paragraph items are simply added to previous paragraph, however if no paragraph exists yet, this will automatically create one. Example block requires all lines to be prefixed, other kinds are determined by the first line.
+	BOOL isExample = YES;
+	for (NSUInteger i=0; i<range.length; i++) {
+		if (components[i].exampleLength > 0) continue;
+		isExample = NO;
+		break;
+	}
+	if (isExample) {
+		[self registerExampleBlockFromLines:block components:components];
+		return;
+	}
+	switch (components[0].kind) {
+		case GBCommentLineKindBug:
+			[self registerBugBlockFromLines:block];
+			return;
+		case GBCommentLineKindWarning:
+			[self registerWarningBlockFromLines:block];
+			return;
+		case GBCommentLineKindUnorderedList:
+		case GBCommentLineKindOrderedList:
+			[self registerListBlockFromLines:block components:components];
+			return;
+		default:
+			if ([self registerDirectivesBlockFromLines:block components:components]) return;
+			break;
+	}
 	
 	// If nothing else is matched, the block is standard text. For that we need to start a new paragraph and process the text. Note that we first need to close all open paragraphs - even if the paragraph was started by a known paragraph item block, new text block always starts a new paragraph at this point. But we must keep the new paragraph open in case next block defines an item.
 	[self popAllParagraphs];
@@ -147,17 +225,13 @@
 
 #pragma mark Comment blocks processing
 
-- (BOOL)registerWarningBlockFromlines:(NSArray *)lines {
-	// Warning block is a GBParagraphSpecialItem containing one or more GBParagraph items.
-	NSString *regex = self.components.warningSectionRegex;
-	if (![[lines firstObject] isMatchedByRegex:regex]) return NO;
-	
-	// Get the description and warn if empty text was found (we still return YES as the block was properly detected as @warning.
+- (void)registerWarningBlockFromLines:(NSArray *)lines {
+	// Warning block is a GBParagraphSpecialItem containing one or more GBParagraph items. The first line is known to start with @warning.
 	NSString *string = [NSString stringByCombiningLines:lines delimitWith:@"\n"];
-	NSString *description = [string stringByMatching:regex capture:1];
+	NSString *description = [string substringFromIndex:[GBCommentLineScanner componentsOfLine:string].descriptionLocation];
 	if ([description length] == 0) {
- 		GBLogWarn(@"Empty @warning block found in %@!", self.sourceFileInfo);
-		return YES;
+ 		GBLogCommentWarn(@"Empty @warning block found in %@!", self.sourceFileInfo);
+		return;
 	}
 	GBLogDebug(@"  - Found warning block '%@' at %@.", [string normalizedDescription], self.sourceFileInfo);
 	
@@ -173,20 +247,15 @@
 	
 	// Register block item to current paragraph.
 	[[self peekParagraph] registerItem:item];
-	return YES;
 }
 
-- (BOOL)registerBugBlockFromLines:(NSArray *)lines {
-	// Bug block is a GBParagraphSpecialItem containing one or more GBCommentParagraph items.
-	NSString *regex = self.components.bugSectionRegex;
-	if (![[lines firstObject] isMatchedByRegex:regex]) return NO;
-	
-	// Get the description and warn if empty text was found (we still return YES as the block was properly detected as @bug.
+- (void)registerBugBlockFromLines:(NSArray *)lines {
+	// Bug block is a GBParagraphSpecialItem containing one or more GBCommentParagraph items. The first line is known to start with @bug.
 	NSString *string = [NSString stringByCombiningLines:lines delimitWith:@"\n"];
-	NSString *description = [string stringByMatching:regex capture:1];
+	NSString *description = [string substringFromIndex:[GBCommentLineScanner componentsOfLine:string].descriptionLocation];
 	if ([description length] == 0) {
- 		GBLogWarn(@"Empty @bug block found in %@!", self.sourceFileInfo);
-		return YES;
+ 		GBLogCommentWarn(@"Empty @bug block found in %@!", self.sourceFileInfo);
+		return;
 	}
 	GBLogDebug(@"  - Found bug block '%@' at %@.", [string normalizedDescription], self.sourceFileInfo);
 	
@@ -202,26 +271,16 @@
 	
 	// Register block item to current paragraph.
 	[[self peekParagraph] registerItem:item];
-	return YES;
 }
 
-- (BOOL)registerExampleBlockFromLines:(NSArray *)lines {
+- (void)registerExampleBlockFromLines:(NSArray *)lines components:(const GBCommentLine *)components {
 	// Example block is a GBParagraphSpecialItem containing one or more GBCommentParagraph items. The block is only considered as example if each line is prefixed with a single tab or 4 spaces. That leading whitespace is removed from each line in registered data. Note that we allow having mixed lines where one starts with tab and another with spaces!
 	
-	// Validate all lines match required prefix. Note that we first used dictionaryByMatchingRegex:withKeysAndCaptures: but it ended with EXC_BAD_ACCESS and I couldn't figure it out, so reverted to captureComponentsMatchedByRegex:
-	NSString *regex = self.components.exampleSectionRegex;
-	NSMutableArray *linesOfCaptures = [NSMutableArray arrayWithCapacity:[lines count]];
-	for (NSString *line in lines) {
-		NSArray *match = [line captureComponentsMatchedByRegex:regex];
-		if ([match count] == 0) return NO;
-		[linesOfCaptures addObject:match];
-	}
-	
-	// So all lines are indeed prefixed with required example whitespace, let's create the item. First prepare string value containing only text without prefix. Note that capture index 0 contains full text, index 1 just the prefix and index 2 just the text.
+	// All lines are known to be prefixed with required example whitespace, so prepare string value containing only text without prefix.
 	NSMutableString *stringValue = [NSMutableString string];
-	[linesOfCaptures enumerateObjectsUsingBlock:^(NSArray *captures, NSUInteger idx, BOOL *stop) {
+	[lines enumerateObjectsUsingBlock:^(NSString *line, NSUInteger idx, BOOL *stop) {
 		if ([stringValue length] > 0) [stringValue appendString:@"\n"];
-		NSString *lineText = [captures objectAtIndex:2];
+		NSString *lineText = [line substringFromIndex:components[idx].exampleLength];
 		[stringValue appendString:lineText];
 	}];	
 	GBLogDebug(@"  - Found example block '%@' at %@.", [stringValue normalizedDescription], self.sourceFileInfo);
@@ -237,25 +296,19 @@
 	
     // Register example block to current paragraph.
     [[self peekParagraph] registerItem:item];
-	return YES;
 }
 
-- (BOOL)registerListBlockFromLines:(NSArray *)lines {
-	// List block contains a hierarhcy of lists, each represented as a GBParagraphListItem, with it's items as GBCommentParagraph. The method handles both, ordered and unordered lists in any depth and any combination. NOTE: list items can be prefixed by tabs or spaces or combination of both, however it's recommended to use single case as depth is calculated simply by testing prefix string length (so single tab is considered same depth as single space).
-#define isMatchingListItemStatement(theText) \
-	([theText isMatchedByRegex:unorderedRegex] || [theText isMatchedByRegex:orderedRegex])
+- (void)registerListBlockFromLines:(NSArray *)lines components:(const GBCommentLine *)components {
+	// List block contains a hierarhcy of lists, each represented as a GBParagraphListItem, with it's items as GBCommentParagraph. The method handles both, ordered and unordered lists in any depth and any combination. NOTE: list items can be prefixed by tabs or spaces or combination of both, however it's recommended to use single case as depth is calculated simply by testing prefix string length (so single tab is considered same depth as single space). The first line is known to start a list.
+#define isListItemLine(theIndex) \
+	(components[theIndex].kind == GBCommentLineKindUnorderedList || components[theIndex].kind == GBCommentLineKindOrderedList)
 	
-	// If the first line doesn't contain directive, exit.
-	// If first line doesn't start a list, we should exit.
-	NSString *unorderedRegex = self.components.unorderedListRegex;
-	NSString *orderedRegex = self.components.orderedListRegex;
-	if (!isMatchingListItemStatement([lines firstObject])) return NO;
 	GBLogDebug(@"  - Found list block at %@.", self.sourceFileInfo);
 	
 	// In the first pass, convert the array of lines into an array of pre-processed items. Each item is a dictionary containing the text and line number. The main reason for this step is to combine multiple line item texts into a single string.
 	NSMutableArray *items = [NSMutableArray arrayWithCapacity:[lines count]];
 	[lines enumerateObjectsUsingBlock:^(NSString *line, NSUInteger idx, BOOL *stop) {
-		if (isMatchingListItemStatement(line)) {
+		if (isListItemLine(idx)) {
 			NSMutableDictionary *data = [NSMutableDictionary dictionaryWithCapacity:3];
 			[data setObject:line forKey:@"text"];
 			[data setObject:[NSNumber numberWithInt:self.currentStartLine + idx] forKey:@"line"];
@@ -280,23 +333,14 @@
 	NSMutableArray *listsStack = [NSMutableArray arrayWithCapacity:[items count]];
 	NSMutableArray *indentsStack = [NSMutableArray arrayWithCapacity:[items count]];
 	[items enumerateObjectsUsingBlock:^(NSDictionary *itemData, NSUInteger idx, BOOL *stop) {
-		BOOL ordered = NO;
-		NSArray *components = nil;
 		NSString *text = [itemData objectForKey:@"text"];
 		NSString *sourceInfo = [NSString stringWithFormat:@"%@%%@", self.currentComment.sourceInfo.filename, [itemData objectForKey:@"line"]];
 		
-		// Match list item.
-		components = [text captureComponentsMatchedByRegex:unorderedRegex];
-		if ([components count] > 0) {
-			ordered = NO;
-		} else {
-			components = [text captureComponentsMatchedByRegex:orderedRegex];
-			ordered = YES;
-		}
-		
-		// Get item components.		
-		NSString *indent = [components objectAtIndex:1];
-		NSString *stringValue = [components objectAtIndex:2];
+		// Get item components. Note that we need to scan combined text as whitespace after the marker may continue on the following lines.
+		GBCommentLine scanned = [GBCommentLineScanner componentsOfLine:text];
+		BOOL ordered = (scanned.kind == GBCommentLineKindOrderedList);
+		NSString *indent = [text substringToIndex:scanned.indentLength];
+		NSString *stringValue = [text substringFromIndex:scanned.descriptionLocation];
 		
 		if ([listsStack count] == 0 || [indent length] > [[indentsStack peek] length]) {
 			// If lists stack is empty, create root list that will hold all items and push original indent. If we found greater indent, we need to start sublist.
@@ -328,26 +372,21 @@
 	
 	// At the end we need to unwind paragraphs stack until we clear all added paragraphs.
 	while ([self.paragraphsStack count] > paragraphsStackSize) [self popParagraph];
-	return YES;
 }
 
-- (BOOL)registerDirectivesBlockFromLines:(NSArray *)lines {
+- (BOOL)registerDirectivesBlockFromLines:(NSArray *)lines components:(const GBCommentLine *)components {
 	// Registers a block containing directives (@param, @return etc.).
-#define isMatchingDirectiveStatement(theText) \
-	([theText isMatchedByRegex:parameterRegex] || [theText isMatchedByRegex:exceptionRegex] || [theText isMatchedByRegex:returnRegex] || [theText isMatchedByRegex:crossRefRegex])
+#define isDirectiveLine(theIndex) \
+	(components[theIndex].kind >= GBCommentLineKindParameter && components[theIndex].kind <= GBCommentLineKindCrossReference)
 	
 	// If the first line doesn't contain directive, exit.
-	NSString *parameterRegex = self.components.parameterDescriptionRegex;
-	NSString *exceptionRegex = self.components.exceptionDescriptionRegex;
-	NSString *returnRegex = self.components.returnDescriptionRegex;
-	NSString *crossRefRegex = self.components.crossReferenceRegex;
-	if (!isMatchingDirectiveStatement([lines firstObject])) return NO;
+	if (!isDirectiveLine(0)) return NO;
 	
 	// In the first pass, convert the array of lines into an array of pre-processed directive items. Note that we use simplified grouping - if a line matches any directive, we start new directive, otherwise we append text to previous one. The result is an array containing dictionaries with text and line number. Exit if we didn't match any directive.
 	NSMutableArray *directives = [NSMutableArray arrayWithCapacity:[lines count]];
 	for (NSUInteger i=0; i<[lines count]; i++) {
 		NSString *line = [lines objectAtIndex:i];
-		if (isMatchingDirectiveStatement(line)) {
+		if (isDirectiveLine(i)) {
 			NSMutableDictionary *data = [NSMutableDictionary dictionaryWithCapacity:2];
 			[data setObject:line forKey:@"text"];
 			[data setObject:[NSNumber numberWithInt:self.currentStartLine + i] forKey:@"line"];
@@ -364,66 +403,55 @@
 	
 	// Process all directives. Note that we must not immediately close paragraphs as we can find additional paragraph blocks belonging to the paragraph later on (i.e. list blocks, example blocks etc.).
 	[directives enumerateObjectsUsingBlock:^(NSDictionary *data, NSUInteger idx, BOOL *stop) {
-		NSArray *components = nil;
 		NSString *directive = [data objectForKey:@"text"];
 		NSString *sourceInfo = [NSString stringWithFormat:@"%@%%@", self.currentComment.sourceInfo.filename, [data objectForKey:@"line"]];
 		
 		// We must close previous directive description paragraph when we encounter another one. Note that this won't register the paragraph to comment as we opened each by specifying them as non-auto registered paragraphs. We leave last directive description paragraph open - we want to add any following paragraph blocks to. The paragraph will be closed either when we end processing or when we encounter another text block. Also note that we don't pop if stack is empty. This can happen when registering @see items which don't push paragraphs!
 		if (idx > 0 && ![self.paragraphsStack isEmpty]) [self popParagraph];
 		
-		// Match @param.
-		components = [directive captureComponentsMatchedByRegex:parameterRegex];
-		if ([components count] > 0) {
-			NSString *name = [components objectAtIndex:1];
-			NSString *text = [components objectAtIndex:2];
-			GBLogDebug(@"    - Found parameter %@ directive with description '%@' at %@...", name, [text normalizedDescription], sourceInfo);
-			GBCommentParagraph *paragraph = [self pushParagraph:NO];
-			[self registerTextItemsFromStringToCurrentParagraph:text];
-			GBCommentArgument *argument = [GBCommentArgument argumentWithName:name description:paragraph];
-			[self.currentComment registerParameter:argument];
-			return;
-		}
-		
-		// Match @exception.
-		components = [directive captureComponentsMatchedByRegex:exceptionRegex];
-		if ([components count] > 0) {
-			NSString *name = [components objectAtIndex:1];
-			NSString *text = [components objectAtIndex:2];
-			GBLogDebug(@"    - Found exception %@ directive with description '%@' at %@...", name, [text normalizedDescription], sourceInfo);
-			GBCommentParagraph *paragraph = [self pushParagraph:NO];
-			[self registerTextItemsFromStringToCurrentParagraph:text];
-			GBCommentArgument *argument = [GBCommentArgument argumentWithName:name description:paragraph];
-			[self.currentComment registerException:argument];
-			return;
-		}
-		
-		// Match @return.
-		components = [directive captureComponentsMatchedByRegex:returnRegex];
-		if ([components count] > 0) {
-			NSString *text = [components objectAtIndex:1];
-			GBLogDebug(@"    - Matched result directive with description '%@' at %@...", [text normalizedDescription], sourceInfo);
-			GBCommentParagraph *paragraph = [self pushParagraph:NO];
-			[self registerTextItemsFromStringToCurrentParagraph:text];
-			[self.currentComment registerResult:paragraph];
-			return;
-		}
-		
-		// Match @see.
-		components = [directive captureComponentsMatchedByRegex:crossRefRegex];
-		if ([components count] > 0) {
-			NSString *text = [components objectAtIndex:1];
-			GBParagraphLinkItem *item = [self linkItemFromString:text range:nil description:nil];
-			if (item) {
-				GBLogDebug(@"    - Matched cross ref directive %@ at %@...", text, sourceInfo);
-				[self.currentComment registerCrossReference:item];
-			} else if (self.settings.warnOnInvalidCrossReference) {
-				GBLogWarn(@"Invalid cross ref %@ found at %@!", text, sourceInfo);
+		// Get directive components. Note that we need to scan combined text as whitespace after the keyword or name may continue on the following lines.
+		GBCommentLine scanned = [GBCommentLineScanner componentsOfLine:directive];
+		NSString *text = [directive substringFromIndex:scanned.descriptionLocation];
+		switch (scanned.kind) {
+			case GBCommentLineKindParameter: {
+				NSString *name = [directive substringWithRange:scanned.name];
+				GBLogDebug(@"    - Found parameter %@ directive with description '%@' at %@...", name, [text normalizedDescription], sourceInfo);
+				GBCommentParagraph *paragraph = [self pushParagraph:NO];
+				[self registerTextItemsFromStringToCurrentParagraph:text];
+				GBCommentArgument *argument = [GBCommentArgument argumentWithName:name description:paragraph];
+				[self.currentComment registerParameter:argument];
+				return;
+			}
+			case GBCommentLineKindException: {
+				NSString *name = [directive substringWithRange:scanned.name];
+				GBLogDebug(@"    - Found exception %@ directive with description '%@' at %@...", name, [text normalizedDescription], sourceInfo);
+				GBCommentParagraph *paragraph = [self pushParagraph:NO];
+				[self registerTextItemsFromStringToCurrentParagraph:text];
+				GBCommentArgument *argument = [GBCommentArgument argumentWithName:name description:paragraph];
+				[self.currentComment registerException:argument];
+				return;
+			}
+			case GBCommentLineKindReturn: {
+				GBLogDebug(@"    - Matched result directive with description '%@' at %@...", [text normalizedDescription], sourceInfo);
+				GBCommentParagraph *paragraph = [self pushParagraph:NO];
+				[self registerTextItemsFromStringToCurrentParagraph:text];
+				[self.currentComment registerResult:paragraph];
+				return;
+			}
+			case GBCommentLineKindCrossReference: {
+				GBParagraphLinkItem *item = [self linkItemFromString:text range:nil description:nil];
+				if (item) {
+					GBLogDebug(@"    - Matched cross ref directive %@ at %@...", text, sourceInfo);
+					[self.currentComment registerCrossReference:item];
+				} else if (self.settings.warnOnInvalidCrossReference) {
+					GBLogCommentWarn(@"Invalid cross ref %@ found at %@!", text, sourceInfo);
+				}
+				return;
 			}
-			return;
 		}
 		
 		// If the line doesn't contain known directive, warn the user.
-		GBLogWarn(@"Found unknown directive '%@' at %@!", directive, sourceInfo);
+		GBLogCommentWarn(@"Found unknown directive '%@' at %@!", directive, sourceInfo);
 	}];
 
 	return YES;
@@ -441,190 +469,217 @@
 
 - (void)registerTextItemsFromStringToCurrentParagraph:(NSString *)string {
 	// Registers the text from the given string to last paragraph. Text is converted to an array of GBParagraphTextItem, GBParagraphLinkItem and GBParagraphDecoratorItem objects. This is the main entry point for text processing, this is the only message that should be used for processing text from higher level methods. WARNING: The client is responsible for adding proper paragraph to the stack!
-	NSString *simplified = [string stringByReplacingOccurrencesOfRegex:@"(\\*_|_\\*)" withString:@"=!="];
-	NSArray *components = [simplified arrayOfDictionariesByMatchingRegex:@"(?s:(\\*|_|=!=|`)(.*?)\\1)" withKeysAndCaptures:@"type", 1, @"value", 2, nil];
+	// Markup is detected in a single pass over string characters: each marker is paired with the next marker of the same kind and the text between is decorated. If a marker has no pair, there are no more markers of that kind in the remaining text, so we remember that and never search for it again; this keeps scanning linear. Text and links are detected within ranges of the same characters, so only the strings of resulting items are created.
 	GBCommentParagraph *paragraph = [self peekParagraph];
-	NSRange search = NSMakeRange(0, [simplified length]);
-	for (NSDictionary *component in components) {
-		// Get range of next formatted section. If not found, exit (we'll deal with remaining text after the loop).
-		NSString *type = [component objectForKey:@"type"];
-		NSRange range = [simplified rangeOfString:type options:0 range:search];
-		if (range.location == NSNotFound) break;
-		
-		// If we skipped some text, add it before handling formatted part!
-		if (range.location > search.location) {
-			NSRange skippedRange = NSMakeRange(search.location, range.location - search.location);
-			NSString *skippedText = [simplified substringWithRange:skippedRange];
-			GBLogDebug(@"  - Found '%@' text at %@, processing for cross refs...", skippedText, self.sourceFileInfo);
-			[self registerTextAndLinkItemsFromString:skippedText toObject:paragraph];
+	NSUInteger length = [string length];
+	unichar stackChars[256];
+	unichar *chars = (length <= 256) ? stackChars : malloc(length * sizeof(unichar));
+	[string getCharacters:chars range:NSMakeRange(0, length)];
+	BOOL unpaired[GBInlineMarkupCount] = { NO };
+	NSUInteger textStart = 0;
+	NSUInteger index = 0;
+	while (index < length) {
+		// Skip normal text and markers we already know have no pair.
+		NSUInteger markerLength = 0;
+		GBInlineMarkup markup = GBInlineMarkupAtIndex(chars, index, length, &markerLength);
+		if (markup == GBInlineMarkupNone || unpaired[markup]) {
+			index += markerLength;
+			continue;
 		}
 
-		// Get formatted text and prepare properly decorated component. Note that we warn the user if we find unknown decorator type (this probably just means we changed some decorator value by forgot to change this part, so it's some sort of "exception" catching).
-		NSString *text = [component valueForKey:@"value"];
-		if ([text length] > 0) {
-			GBParagraphDecoratorItem *decorator = [GBParagraphDecoratorItem paragraphItemWithStringValue:text];
-			if ([type isEqualToString:@"*"]) {
-				GBLogDebug(@"  - Found '%@' formatted as bold at %@, processing for cross refs...", [text normalizedDescription], self.sourceFileInfo);
-				decorator.decorationType = GBDecorationTypeBold;
-			} else if ([type isEqualToString:@"_"]) {
-				GBLogDebug(@"  - Found '%@' formatted as italics at %@, processing for cross refs...", [text normalizedDescription], self.sourceFileInfo);
-				decorator.decorationType = GBDecorationTypeItalics;
-			} else if ([type isEqualToString:@"`"]) {
-				GBLogDebug(@"  - Found '%@' formatted as code at %@, processing for cross refs...", [text normalizedDescription], self.sourceFileInfo);
-				decorator.decorationType = GBDecorationTypeCode;
-			} else if ([type isEqualToString:@"=!="]) {
-				// Note that this case requires us to properly registere text to inner decorator but register outer one to the paragraph, so we do it manually!
-				GBLogDebug(@"  - Found '%@' formatted as bold-italics at %@, processing for cross refs...", [text normalizedDescription], self.sourceFileInfo);
-				GBParagraphDecoratorItem *inner = [GBParagraphDecoratorItem paragraphItemWithStringValue:text];
-				decorator.decorationType = GBDecorationTypeBold;
-				[decorator registerItem:inner];
-				inner.decorationType = GBDecorationTypeItalics;
-				[self registerTextAndLinkItemsFromString:text toObject:inner];
-				[paragraph registerItem:decorator];
-				decorator = nil;
-			} else {
-				GBLogWarn(@"Unknown text decorator type %@ detected at %@!", type, self.sourceFileInfo);
-				decorator = nil;
-			}
-			
-			if (decorator) {
-				[self registerTextAndLinkItemsFromString:text toObject:decorator];
-				[paragraph registerItem:decorator];
-			}
+		// Find the closing marker. Note that we need to step over whole markers, so that we don't split bold-italics ones.
+		NSUInteger closing = index + markerLength;
+		NSUInteger closingLength = 0;
+		while (closing < length && GBInlineMarkupAtIndex(chars, closing, length, &closingLength) != markup) closing += closingLength;
+		if (closing >= length) {
+			unpaired[markup] = YES;
+			index += markerLength;
+			continue;
 		}
 
-		// Prepare next search range.
-		NSUInteger location = range.location + range.length * 2 + [text length];
-		search = NSMakeRange(location, [simplified length] - location);
-	};
+		// If we skipped some text, add it before handling formatted part!
+		if (index > textStart) {
+			NSRange skippedRange = NSMakeRange(textStart, index - textStart);
+			GBLogDebug(@"  - Found '%@' text at %@, processing for cross refs...", [[string substringWithRange:skippedRange] normalizedDescription], self.sourceFileInfo);
+			[self registerTextAndLinkItemsFromCharacters:chars range:skippedRange ofString:string toObject:paragraph];
+		}
+		NSRange formattedRange = NSMakeRange(index + markerLength, closing - index - markerLength);
+		[self registerDecoratorItemWithMarkup:markup fromCharacters:chars range:formattedRange ofString:string toParagraph:paragraph];
+		index = textStart = closing + closingLength;
+	}
 
 	// If we have some remaining text, append it now.
-	if ([simplified length] > search.location) {
-		NSString *remainingText = [simplified substringWithRange:search];
-		GBLogDebug(@"  - Found '%@' text at %@, processing for cross refs...", [remainingText normalizedDescription], self.sourceFileInfo);
-		[self registerTextAndLinkItemsFromString:remainingText toObject:paragraph];
+	if (length > textStart) {
+		NSRange remainingRange = NSMakeRange(textStart, length - textStart);
+		GBLogDebug(@"  - Found '%@' text at %@, processing for cross refs...", [[string substringWithRange:remainingRange] normalizedDescription], self.sourceFileInfo);
+		[self registerTextAndLinkItemsFromCharacters:chars range:remainingRange ofString:string toObject:paragraph];
+	}
+	if (chars != stackChars) free(chars);
+}
+
+- (void)registerDecoratorItemWithMarkup:(GBInlineMarkup)markup fromCharacters:(const unichar *)chars range:(NSRange)range ofString:(NSString *)string toParagraph:(GBCommentParagraph *)paragraph {
+	// Get formatted text and prepare properly decorated component. Note that empty formatted text is ignored.
+	if (range.length == 0) return;
+	NSString *text = [string substringWithRange:range];
+	GBParagraphDecoratorItem *decorator = [GBParagraphDecoratorItem paragraphItemWithStringValue:text];
+	switch (markup) {
+		case GBInlineMarkupBold:
+			GBLogDebug(@"  - Found '%@' formatted as bold at %@, processing for cross refs...", [text normalizedDescription], self.sourceFileInfo);
+			decorator.decorationType = GBDecorationTypeBold;
+			break;
+		case GBInlineMarkupItalics:
+			GBLogDebug(@"  - Found '%@' formatted as italics at %@, processing for cross refs...", [text normalizedDescription], self.sourceFileInfo);
+			decorator.decorationType = GBDecorationTypeItalics;
+			break;
+		case GBInlineMarkupCode:
+			GBLogDebug(@"  - Found '%@' formatted as code at %@, processing for cross refs...", [text normalizedDescription], self.sourceFileInfo);
+			decorator.decorationType = GBDecorationTypeCode;
+			break;
+		case GBInlineMarkupBoldItalics: {
+			// Note that this case requires us to properly register text to inner decorator but register outer one to the paragraph, so we do it manually!
+			GBLogDebug(@"  - Found '%@' formatted as bold-italics at %@, processing for cross refs...", [text normalizedDescription], self.sourceFileInfo);
+			GBParagraphDecoratorItem *inner = [GBParagraphDecoratorItem paragraphItemWithStringValue:text];
+			decorator.decorationType = GBDecorationTypeBold;
+			[decorator registerItem:inner];
+			inner.decorationType = GBDecorationTypeItalics;
+			[self registerTextAndLinkItemsFromCharacters:chars range:range ofString:string toObject:inner];
+			[paragraph registerItem:decorator];
+			return;
+		}
 	}
+	[self registerTextAndLinkItemsFromCharacters:chars range:range ofString:string toObject:decorator];
+	[paragraph registerItem:decorator];
 }
 
-- (void)registerTextAndLinkItemsFromString:(NSString *)string toObject:(id)object {
-	// Scans the given string for possible links and converts the text to an array of GBParagraphTextItem and GBParagraphLinkItem objects which are ultimately registered to the given object. NOTE: This message is intended to be sent from registerTextItemsFromStringToCurrentParagraph: and should not be used otherwise! WARNING: The given object must respond to registerItem: message!
-#define registerTextItemFromString(theString) \
-	if ([theString length] > 0) { \
-		GBLogDebug(@"    - Found text '%@'...", [theString normalizedDescription]); \
-		GBParagraphTextItem *textItem = [GBParagraphTextItem paragraphItemWithStringValue:theString]; \
+- (void)registerTextAndLinkItemsFromCharacters:(const unichar *)chars range:(NSRange)range ofString:(NSString *)string toObject:(id)object {
+	// Scans the given range of string characters for possible links and converts the text to an array of GBParagraphTextItem and GBParagraphLinkItem objects which are ultimately registered to the given object. NOTE: This message is intended to be sent from registerTextItemsFromStringToCurrentParagraph: and should not be used otherwise! WARNING: The given object must respond to registerItem: message!
+#define registerTextItemFromRange(theRange) \
+	if (theRange.length > 0) { \
+		NSString *textValue = [string substringWithRange:theRange]; \
+		GBLogDebug(@"    - Found text '%@'...", [textValue normalizedDescription]); \
+		GBParagraphTextItem *textItem = [GBParagraphTextItem paragraphItemWithStringValue:textValue]; \
 		[object registerItem:textItem]; \
-		[theString setString:@""]; \
 	}
 #define registerLinkItem(theItem, theType) { \
 	GBLogDebug(@"    - Found %@ %@ cross ref..", theType, theItem.stringValue); \
+	GBProfileCount(@"crossReferences", 1); \
 	[object registerItem:theItem]; \
 }
-#define skipTextFromString(theString) { \
-	if (theString) { \
-		[text appendString:theString]; \
-		string = [string substringFromIndex:[theString length]]; \
-	} \
-}
-	// Progressively chip away the string and test if it starts with any known cross reference. If so, register link item, otherwise consider the text as normal text item, so skip to the next word.
-	NSMutableString *text = [NSMutableString stringWithCapacity:[string length]];
-	NSRange range = NSMakeRange(0, 0);
-	while ([string length] > 0) {
-		// If the string starts with any recognized cross reference, add the link item and skip it's text, otherwise mark the word until next whitespace as text item.
+	// Walk the range word by word and test if the word starts with any known cross reference. If so, register the text up to it and the link item and continue after the link, otherwise consider the word as part of normal text item. Links never extend past the end of the range.
+	GBProfileBegin(crossRefSample);
+	NSUInteger end = NSMaxRange(range);
+	NSUInteger textStart = range.location;
+	NSUInteger index = range.location;
+	while (index < end) {
+		NSRange linkRange = NSMakeRange(0, 0);
 		NSString *description = nil;
-		GBParagraphLinkItem *linkItem = [self linkItemFromString:string range:&range description:&description];
+		GBParagraphLinkItem *linkItem = [self linkItemAtIndex:index ofCharacters:chars length:end string:string range:&linkRange description:&description];
 		if (linkItem) {
-			skipTextFromString([string substringToIndex:range.location]);
-			registerTextItemFromString(text);
+			registerTextItemFromRange(NSMakeRange(textStart, linkRange.location - textStart));
 			registerLinkItem(linkItem, description);
-			string = [string substringFromIndex:range.length];
+			index = textStart = NSMaxRange(linkRange);
 		} else {
-			skipTextFromString([string stringByMatching:@"^\\S+"]);
+			while (index < end && !GBIsCommentLineWhitespace(chars[index])) index++;
 		}
-		
-		// Skip any leading whitespace until the next word and mark it as text item.
-		skipTextFromString([string stringByMatching:@"^\\s+"]);
+
+		// Skip any whitespace until the next word; it becomes part of the text item.
+		while (index < end && GBIsCommentLineWhitespace(chars[index])) index++;
 	}
-	
-	// Append any remaining text 
-	registerTextItemFromString(text);
+
+	// Append any remaining text.
+	registerTextItemFromRange(NSMakeRange(textStart, end - textStart));
+	GBProfileEnd(crossRefSample, kGBProfilerPhaseCrossReferences);
 }
 
 #pragma mark Cross references detection
 
 - (id)linkItemFromString:(NSString *)string range:(NSRange *)range description:(NSString **)description {
-	// Matches any cross reference at the start of the given string and creates GBParagraphLinkItem, match range and description suitable for logging if found. If the string doesn't represent any known cross reference, nil is returned and the other parameters are left untouched. Note that the order of testing is somewhat important (for example we should test for category before class or protocol to avoid text up to open parenthesis being recognized as a class where in fact it's category).
-	GBParagraphLinkItem *result = nil;
-	NSString *desc = nil;
-	if ((result = [self categoryLinkFromString:string range:range])) {
-		desc = @"category";
-	} else if ((result = [self classLinkFromString:string range:range])) {
-		desc = @"class";
-	} else if ((result = [self protocolLinkFromString:string range:range])) {
-		desc = @"protocol";
-	} else if ((result = [self remoteMemberLinkItemFromString:string range:range])) {
-		desc = @"remote member";
-	} else if ((result = [self localMemberLinkFromString:string range:range])) {
-		desc = @"local member";
-	} else if ((result = [self urlLinkItemFromString:string range:range])) {
-		desc = @"url";
-	}
-	if (result && description) *description = desc;
+	// Matches any cross reference at the start of the given string, ignoring leading whitespace, and creates GBParagraphLinkItem, match range and description suitable for logging if found. If the string doesn't represent any known cross reference, nil is returned and the other parameters are left untouched.
+	NSUInteger length = [string length];
+	unichar stackChars[256];
+	unichar *chars = (length <= 256) ? stackChars : malloc(length * sizeof(unichar));
+	[string getCharacters:chars range:NSMakeRange(0, length)];
+	NSUInteger index = 0;
+	while (index < length && GBIsCommentLineWhitespace(chars[index])) index++;
+	id result = [self linkItemAtIndex:index ofCharacters:chars length:length string:string range:range description:description];
+	if (chars != stackChars) free(chars);
 	return result;
 }
 
-- (id)remoteMemberLinkItemFromString:(NSString *)string range:(NSRange *)range {
-	// Matches the beginning of the string for remote member cross reference (in the format [Object member]). If found, GBParagraphLinkItem is prepared and returned. NOTE: The range argument is used to return the range of all link text, including optional <> markers.
-	// If the string starts with remote link
-	NSArray *components = [string captureComponentsMatchedByRegex:self.components.remoteMemberCrossReferenceRegex];
-	if ([components count] == 0) return nil;
-	
-	// Get link components. Index 0 contains full text, including optional <>, index 1 object name, index 2 member name.
-	NSString *linkText = [components objectAtIndex:0];
-	NSString *objectName = [components objectAtIndex:1];
-	NSString *memberName = [components objectAtIndex:2];
-	
-	// Validate the link to match it to known object. If no known object is matched, warn, update search range and continue with remaining text. This is required so that we treat unknown objects as normal text later on and still catch proper references that may be hiding in the remainder.
-	id referencedObject = [self.store classWithName:objectName];
-	if (!referencedObject) {
-		referencedObject = [self.store categoryWithName:objectName];
-		if (!referencedObject) {
-			referencedObject = [self.store protocolWithName:objectName];
-			if (!referencedObject) {
-				if (self.settings.warnOnInvalidCrossReference) GBLogWarn(@"Invalid %@ reference found near %@, unknown object!", linkText, self.sourceFileInfo);
-				return nil;
-			}
+- (id)linkItemAtIndex:(NSUInteger)index ofCharacters:(const unichar *)chars length:(NSUInteger)length string:(NSString *)string range:(NSRange *)range description:(NSString **)description {
+	// Resolves candidates found by cross reference matcher at the given index of the given string characters, considering only characters up to the given length. Candidates are given in the order of testing (for example category before class or protocol to avoid text up to open parenthesis being recognized as a class where in fact it's category), the first one that resolves to known object, member or address wins. Matcher only knows the names of objects, so we need to validate them against the symbol index, which also reflects objects removed during processing.
+	GBCrossReference candidates[GBCrossReferenceMaximumCandidates];
+	NSUInteger count = [self.crossReferenceMatcher crossReferencesAtIndex:index ofCharacters:chars length:length context:self.currentContext candidates:candidates];
+	for (NSUInteger i=0; i<count; i++) {
+		GBCrossReference candidate = candidates[i];
+		NSString *name = [string substringWithRange:candidate.name];
+		GBParagraphLinkItem *result = nil;
+		NSString *desc = nil;
+		switch (candidate.kind) {
+			case GBCrossReferenceKindCategory:
+				result = [self objectLinkItemWithName:name object:[self.symbolIndex categoryWithName:name]];
+				desc = @"category";
+				break;
+			case GBCrossReferenceKindClass:
+				result = [self objectLinkItemWithName:name object:[self.symbolIndex classWithName:name]];
+				desc = @"class";
+				break;
+			case GBCrossReferenceKindProtocol:
+				result = [self objectLinkItemWithName:name object:[self.symbolIndex protocolWithName:name]];
+				desc = @"protocol";
+				break;
+			case GBCrossReferenceKindRemoteMember:
+				result = [self remoteMemberLinkItemWithObjectName:name memberName:[string substringWithRange:candidate.member] linkText:[string substringWithRange:candidate.range]];
+				desc = @"remote member";
+				break;
+			case GBCrossReferenceKindLocalMember:
+				result = [self localMemberLinkItemWithSelector:name];
+				desc = @"local member";
+				break;
+			case GBCrossReferenceKindURL:
+				result = [self urlLinkItemWithAddress:name];
+				desc = @"url";
+				break;
 		}
+		if (result) {
+			if (range) *range = candidate.range;
+			if (description) *description = desc;
+			return result;
+		}
+	}
+	return nil;
+}
+
+- (id)remoteMemberLinkItemWithObjectName:(NSString *)objectName memberName:(NSString *)memberName linkText:(NSString *)linkText {
+	// Validates remote member cross reference (in the format [Object member]). If valid, GBParagraphLinkItem is prepared and returned. NOTE: The link text contains all link text, including optional <> markers.
+	// Validate the link to match it to known object. If no known object is matched, warn and return nil. This is required so that we treat unknown objects as normal text later on and still catch proper references that may be hiding in the remainder.
+	id referencedObject = [self.symbolIndex objectWithName:objectName];
+	if (!referencedObject) {
+		if (self.settings.warnOnInvalidCrossReference) GBLogCommentWarn(@"Invalid %@ reference found near %@, unknown object!", linkText, self.sourceFileInfo);
+		return nil;
 	}
 	
-	// Ok, so we have found referenced object in store, now search the member. If member isn't recognized, warn, update search range and continue with remaining text. This is required so that we treat unknown members as normal text later on and still catch proper references in remainder.
+	// Ok, so we have found referenced object in store, now search the member. If member isn't recognized, warn and return nil. This is required so that we treat unknown members as normal text later on and still catch proper references in remainder.
 	id referencedMember = [[referencedObject methods] methodBySelector:memberName];
 	if (!referencedMember) {
-		if (self.settings.warnOnInvalidCrossReference) GBLogWarn(@"Invalid %@ reference found near %@, unknown method!", linkText, self.sourceFileInfo);
+		if (self.settings.warnOnInvalidCrossReference) GBLogCommentWarn(@"Invalid %@ reference found near %@, unknown method!", linkText, self.sourceFileInfo);
 		return nil;
 	}
 	
-	// Right, we have valid reference to known remote member, create the link item, prepare range and return.
+	// Right, we have valid reference to known remote member, create the link item and return. Note that the reference is relative to the context.
+	self.currentCommentDependsOnContext = YES;
 	NSString *stringValue = [linkText stringByTrimmingCharactersInSet:[NSCharacterSet characterSetWithCharactersInString:@"<>"]];
 	GBParagraphLinkItem *result = [GBParagraphLinkItem paragraphItemWithStringValue:stringValue];
 	result.href = [self.settings htmlReferenceForObject:referencedMember fromSource:self.currentContext];
 	result.context = referencedObject;
 	result.member = referencedMember;
 	result.isLocal = NO;
-	if (range) *range = [string rangeOfString:linkText];
 	return result;
 }
 
-- (id)localMemberLinkFromString:(NSString *)string range:(NSRange *)range {
-	// Matches the beginning of the string for local member cross reference. If found, GBParagraphLinkItem is prepared and returned. NOTE: The range argument is used to return the range of all link text, including optional <> markers. NOTE: Note that we can skip local member cross ref testing if no context (i.e. class, category or protocol) is given!
-	if (!self.currentContext) return nil;
-	NSArray *components = [string captureComponentsMatchedByRegex:self.components.localMemberCrossReferenceRegex];
-	if ([components count] == 0) return nil;
-	
-	// Get link components. Index 0 contains full text, including optional <>, index 1 just the member selector.
-	NSString *linkText = [components objectAtIndex:0];
-	NSString *selector = [components objectAtIndex:1];
-	
-	// Validate the selector against the context. If context doesn't implement the method, exit.
+- (id)localMemberLinkItemWithSelector:(NSString *)selector {
+	// Validates the selector against the current context. If context implements the method, GBParagraphLinkItem is prepared and returned.
+	self.currentCommentDependsOnContext = YES;
 	GBMethodData *referencedMethod = [[[self currentContext] methods] methodBySelector:selector];
 	if (!referencedMethod) return nil;
 	
@@ -634,89 +689,24 @@
 	result.context = self.currentContext;
 	result.member = referencedMethod;
 	result.isLocal = YES;
-	if (range) *range = [string rangeOfString:linkText];
-	return result;
-}
-
-- (id)classLinkFromString:(NSString *)string range:(NSRange *)range {
-	// Matches the beginning of the string for class cross reference. If found, GBParagraphLinkItem is prepared and returned. NOTE: The range argument is used to return the range of all link text, including optional <> markers.
-	NSArray *components = [string captureComponentsMatchedByRegex:self.components.objectCrossReferenceRegex];
-	if ([components count] == 0) return nil;
-	
-	// Get link components. Index 0 contains full text, including optional <>, index 1 just the object name.
-	NSString *linkText = [components objectAtIndex:0];
-	NSString *objectName = [components objectAtIndex:1];
-	
-	// Validate the selector against the context. If context doesn't implement the method, exit.
-	GBClassData *referencedObject = [self.store classWithName:objectName];
-	if (!referencedObject) return nil;
-	
-	// Ok, we have valid method, return the link item.
-	GBParagraphLinkItem *result = [GBParagraphLinkItem paragraphItemWithStringValue:objectName];
-	result.href = [self.settings htmlReferenceForObject:referencedObject fromSource:self.currentContext];
-	result.context = referencedObject;
-	result.isLocal = (referencedObject == self.currentContext);
-	if (range) *range = [string rangeOfString:linkText];
-	return result;
-}
-
-- (id)categoryLinkFromString:(NSString *)string range:(NSRange *)range {
-	// Matches the beginning of the string for category cross reference. If found, GBParagraphLinkItem is prepared and returned. NOTE: The range argument is used to return the range of all link text, including optional <> markers.
-	NSArray *components = [string captureComponentsMatchedByRegex:self.components.categoryCrossReferenceRegex];
-	if ([components count] == 0) return nil;
-	
-	// Get link components. Index 0 contains full text, including optional <>, index 1 just the object name.
-	NSString *linkText = [components objectAtIndex:0];
-	NSString *objectName = [components objectAtIndex:1];
-	
-	// Validate the selector against the context. If context doesn't implement the method, exit.
-	GBCategoryData *referencedObject = [self.store categoryWithName:objectName];
-	if (!referencedObject) return nil;
-	
-	// Ok, we have valid method, return the link item.
-	GBParagraphLinkItem *result = [GBParagraphLinkItem paragraphItemWithStringValue:objectName];
-	result.href = [self.settings htmlReferenceForObject:referencedObject fromSource:self.currentContext];
-	result.context = referencedObject;
-	result.isLocal = (referencedObject == self.currentContext);
-	if (range) *range = [string rangeOfString:linkText];
 	return result;
 }
 
-- (id)protocolLinkFromString:(NSString *)string range:(NSRange *)range {
-	// Matches the beginning of the string for protocol cross reference. If found, GBParagraphLinkItem is prepared and returned. NOTE: The range argument is used to return the range of all link text, including optional <> markers.
-	NSArray *components = [string captureComponentsMatchedByRegex:self.components.objectCrossReferenceRegex];
-	if ([components count] == 0) return nil;
-	
-	// Get link components. Index 0 contains full text, including optional <>, index 1 just the object name.
-	NSString *linkText = [components objectAtIndex:0];
-	NSString *objectName = [components objectAtIndex:1];
-	
-	// Validate the selector against the context. If context doesn't implement the method, exit.
-	GBProtocolData *referencedObject = [self.store protocolWithName:objectName];
-	if (!referencedObject) return nil;
-	
-	// Ok, we have valid method, return the link item.
-	GBParagraphLinkItem *result = [GBParagraphLinkItem paragraphItemWithStringValue:objectName];
-	result.href = [self.settings htmlReferenceForObject:referencedObject fromSource:self.currentContext];
-	result.context = referencedObject;
-	result.isLocal = (referencedObject == self.currentContext);
-	if (range) *range = [string rangeOfString:linkText];
+- (id)objectLinkItemWithName:(NSString *)name object:(id)object {
+	// Prepares GBParagraphLinkItem for the given class, category or protocol as resolved by the caller. If the object is not known, nil is returned.
+	if (!object) return nil;
+	self.currentCommentDependsOnContext = YES;
+	GBParagraphLinkItem *result = [GBParagraphLinkItem paragraphItemWithStringValue:name];
+	result.href = [self.settings htmlReferenceForObject:object fromSource:self.currentContext];
+	result.context = object;
+	result.isLocal = (object == self.currentContext);
 	return result;
 }
 
-- (id)urlLinkItemFromString:(NSString *)string range:(NSRange *)range {
-	// Matches the beginning of the string for URL cross reference. If found, GBParagraphLinkItem is prepared and returned. NOTE: The range argument is used to return the range of all link text, including optional <> markers.
-	NSArray *components = [string captureComponentsMatchedByRegex:self.components.urlCrossReferenceRegex];
-	if ([components count] == 0) return nil;
-	
-	// Get link components. Index 0 contains full text, including optional <>, index 1 just the URL address.
-	NSString *linkText = [components objectAtIndex:0];
-	NSString *address = [components objectAtIndex:1];
-	
-	// Create link item, prepare range and return.
+- (id)urlLinkItemWithAddress:(NSString *)address {
+	// Prepares GBParagraphLinkItem for the given URL address.
 	GBParagraphLinkItem *result = [GBParagraphLinkItem paragraphItemWithStringValue:address];
 	result.href = address;
-	if (range) *range = [string rangeOfString:linkText];
 	return result;
 }
 
@@ -762,15 +752,17 @@
 	return [NSString stringWithFormat:@"%@@%lu", self.currentComment.sourceInfo.filename, self.currentStartLine];
 }
 
-- (GBCommentComponentsProvider *)components {
-	return self.settings.commentComponents;
-}
-
 @synthesize paragraphsStack;
+@synthesize currentLinesComponents;
 @synthesize currentStartLine;
 @synthesize currentComment;
 @synthesize currentContext;
+@synthesize currentCommentDependsOnContext;
+@synthesize currentCommentReportedWarnings;
 @synthesize settings;
 @synthesize store;
+@synthesize symbolIndex;
+@synthesize crossReferenceMatcher;
+@synthesize commentsCache;
 
 @end
@@ -0,0 +1,109 @@
+//
+//  GBCrossReferenceMatcher.h
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GBStore;
+
+/** The kinds of cross references recognized by `GBCrossReferenceMatcher`. */
+enum {
+	GBCrossReferenceKindCategory,
+	GBCrossReferenceKindClass,
+	GBCrossReferenceKindProtocol,
+	GBCrossReferenceKindRemoteMember,
+	GBCrossReferenceKindLocalMember,
+	GBCrossReferenceKindURL,
+};
+typedef NSUInteger GBCrossReferenceKind;
+
+/** The maximum number of candidates `GBCrossReferenceMatcher` returns for a single location. */
+enum {
+	GBCrossReferenceMaximumCandidates = 6
+};
+
+/** Describes a possible cross reference found by `GBCrossReferenceMatcher`.
+
+ Range is the range of all link text, including optional `<>` markers. Name is the range of the category, class or protocol name, the selector of local member, the object name of remote member or the URL address. Member is the range of the selector of remote member and is empty for all other kinds.
+ */
+typedef struct {
+	GBCrossReferenceKind kind;
+	NSRange range;
+	NSRange name;
+	NSRange member;
+} GBCrossReference;
+
+/** Finds possible cross references in comment text without using regular expressions.
+
+ Names of all classes, categories and protocols registered to the store and selectors of all their methods are compiled into a single trie of characters when the matcher is created. At each word, the matcher determines the extent of possible object name, selector or URL in a single pass over the characters and walks the trie along it. Most words are rejected after the first few characters, without creating any strings, so cost of link detection depends on the length of the text instead of the number of known objects or the number of supported link kinds.
+
+ The matcher recognizes the same syntax as the corresponding regular expressions from `GBCommentComponentsProvider`, but only at the start of a word, after optional punctuation. It only reports candidates; the caller is responsible for resolving them to actual objects, as objects may be removed from the store after the matcher was created. Remote members are reported based on their syntax alone, so that invalid references can be reported to the user.
+
+ Matcher is immutable once created, so it can be used from multiple threads concurrently.
+ */
+@interface GBCrossReferenceMatcher : NSObject {
+	@private
+	GBStore *_store;
+	NSMutableData *_nodes;
+	NSMutableSet *_objectsWithSelectors;
+}
+
+///---------------------------------------------------------------------------------------
+/// @name Initialization & disposal
+///---------------------------------------------------------------------------------------
+
+/** Returns autoreleased matcher for all objects registered to the given store.
+
+ @param store The store whose objects to match.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given store is `nil`.
+ */
++ (id)matcherWithStore:(GBStore *)store;
+
+/** Initializes the matcher for all objects registered to the given store.
+
+ This is the designated initializer.
+
+ @param store The store whose objects to match.
+ @return Returns initialized instance or `nil` if initialization fails.
+ @exception NSException Thrown if the given store is `nil`.
+ */
+- (id)initWithStore:(GBStore *)store;
+
+///---------------------------------------------------------------------------------------
+/// @name Matching
+///---------------------------------------------------------------------------------------
+
+/** Returns possible cross references starting at the given index of the given characters.
+
+ The index should point to the start of a word or to the first character following previously matched cross reference. Candidates are returned in the order in which they should be tested: category, class, protocol, remote member, local member and URL. The same text may be returned for several kinds; for example a name may be both, class and protocol.
+
+ Local members are only returned if context is given. If the context was registered to the store, only selectors of known methods are returned, otherwise any possible selector is returned, as the matcher doesn't know methods of the context.
+
+ @param index The index at which to start matching.
+ @param chars The characters to match.
+ @param length The number of characters.
+ @param context The class, category or protocol for local members or `nil`.
+ @param candidates The array of at least `GBCrossReferenceMaximumCandidates` items to receive candidates.
+ @return Returns the number of candidates written to the array, 0 if there is no possible cross reference at the given index.
+ */
+- (NSUInteger)crossReferencesAtIndex:(NSUInteger)index ofCharacters:(const unichar *)chars length:(NSUInteger)length context:(id)context candidates:(GBCrossReference *)candidates;
+
+/** Indicates whether selectors of the given context's methods were compiled into the matcher.
+
+ For such contexts local member candidates only depend on the text, as they are filtered by selectors of all known methods. For other contexts any possible selector is returned as local member candidate.
+
+ @param context The class, category or protocol to test.
+ @return Returns `YES` if the context was registered to the store when the matcher was created, `NO` otherwise.
+ @see crossReferencesAtIndex:ofCharacters:length:context:candidates:
+ */
+- (BOOL)knowsSelectorsOfContext:(id)context;
+
+/** The store this matcher was built from. */
+@property (readonly) GBStore *store;
+
+@end
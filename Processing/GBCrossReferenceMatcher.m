@@ -0,0 +1,283 @@
+//
+//  GBCrossReferenceMatcher.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBStore.h"
+#import "GBDataObjects.h"
+#import "GBCommentLineScanner.h"
+#import "GBCrossReferenceMatcher.h"
+
+// Kinds of symbols ending at a trie node; a name may be used by several kinds of symbols at once.
+enum {
+	GBSymbolKindClass = 1 << 0,
+	GBSymbolKindCategory = 1 << 1,
+	GBSymbolKindProtocol = 1 << 2,
+	GBSymbolKindSelector = 1 << 3,
+};
+
+// Trie nodes are stored in a flat array; children of each node are linked through siblings. Index 0 is the root, which is never a child, so 0 also marks missing child or sibling.
+typedef struct {
+	unichar character;
+	NSUInteger kinds;
+	NSUInteger child;
+	NSUInteger sibling;
+} GBCrossReferenceMatcherNode;
+
+// Punctuation that may preceed cross reference; these are the characters object cross reference regex skips before the name.
+static inline BOOL GBIsLeadingPunctuation(unichar c) {
+	return (c == '(' || c == ')' || c == '>' || c == ',' || c == '.' || c == ':' || c == ';' || c == '!' || c == '?');
+}
+
+// Characters ending class and protocol names: [^>,.:;!?()\s].
+static inline BOOL GBIsObjectNameDelimiter(unichar c) {
+	return GBIsLeadingPunctuation(c) || GBIsCommentLineWhitespace(c);
+}
+
+// Characters ending category names: [^>,.:;!?)\s], category name must be followed by closing parenthesis.
+static inline BOOL GBIsCategoryNameDelimiter(unichar c) {
+	return (c != '(' && GBIsObjectNameDelimiter(c));
+}
+
+// Characters ending selectors: [^>,.;!?()\s]; unlike names, selectors contain colons.
+static inline BOOL GBIsSelectorDelimiter(unichar c) {
+	return (c != ':' && GBIsObjectNameDelimiter(c));
+}
+
+static inline BOOL GBIsURLAlphanumeric(unichar c) {
+	return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'));
+}
+
+// URL host and port: [a-zA-Z0-9@:\-.].
+static inline BOOL GBIsURLHostCharacter(unichar c) {
+	return (GBIsURLAlphanumeric(c) || c == '@' || c == ':' || c == '-' || c == '.');
+}
+
+// URL path components following each slash: [a-zA-Z0-9\-._?,'+\&%$=~*!():@\\].
+static inline BOOL GBIsURLPathCharacter(unichar c) {
+	if (GBIsURLAlphanumeric(c)) return YES;
+	switch (c) {
+		case '-': case '.': case '_': case '?': case ',': case '\'': case '+': case '&': case '%': case '$':
+		case '=': case '~': case '*': case '!': case '(': case ')': case ':': case '@': case '\\':
+			return YES;
+	}
+	return NO;
+}
+
+static const char *GBURLPrefixes[] = { "mailto:", "http://", "https://", "ftp://", "ftps://", "news://", "rss://", "file://" };
+
+@interface GBCrossReferenceMatcher ()
+
+- (void)addSymbol:(NSString *)symbol ofKind:(NSUInteger)kind;
+- (void)addSelectorsOfObject:(id<GBObjectDataProviding>)object;
+- (NSUInteger)childOfNode:(NSUInteger)node withCharacter:(unichar)character;
+- (NSUInteger)kindsOfSymbolInCharacters:(const unichar *)chars range:(NSRange)range;
+- (BOOL)scanRemoteMemberAtIndex:(NSUInteger)index ofCharacters:(const unichar *)chars length:(NSUInteger)length toCandidate:(GBCrossReference *)candidate;
+- (NSUInteger)lengthOfURLAtIndex:(NSUInteger)index ofCharacters:(const unichar *)chars length:(NSUInteger)length;
+
+@end
+
+#pragma mark -
+
+@implementation GBCrossReferenceMatcher
+
+#pragma mark Initialization & disposal
+
++ (id)matcherWithStore:(GBStore *)store {
+	return [[[self alloc] initWithStore:store] autorelease];
+}
+
+- (id)initWithStore:(GBStore *)store {
+	NSParameterAssert(store != nil);
+	GBLogDebug(@"Initializing cross reference matcher for %@...", store);
+	self = [super init];
+	if (self) {
+		_store = [store retain];
+		_nodes = [[NSMutableData alloc] initWithLength:sizeof(GBCrossReferenceMatcherNode)];
+		_objectsWithSelectors = [[NSMutableSet alloc] init];
+		for (GBClassData *class in store.classes) {
+			[self addSymbol:class.nameOfClass ofKind:GBSymbolKindClass];
+			[self addSelectorsOfObject:class];
+		}
+		for (GBCategoryData *category in store.categories) {
+			[self addSymbol:category.idOfCategory ofKind:GBSymbolKindCategory];
+			[self addSelectorsOfObject:category];
+		}
+		for (GBProtocolData *protocol in store.protocols) {
+			[self addSymbol:protocol.nameOfProtocol ofKind:GBSymbolKindProtocol];
+			[self addSelectorsOfObject:protocol];
+		}
+	}
+	return self;
+}
+
+- (void)dealloc {
+	[_store release];
+	[_nodes release];
+	[_objectsWithSelectors release];
+	[super dealloc];
+}
+
+#pragma mark Compiling
+
+- (void)addSelectorsOfObject:(id<GBObjectDataProviding>)object {
+	for (GBMethodData *method in object.methods.methods) [self addSymbol:method.methodSelector ofKind:GBSymbolKindSelector];
+	[_objectsWithSelectors addObject:object];
+}
+
+- (void)addSymbol:(NSString *)symbol ofKind:(NSUInteger)kind {
+	NSUInteger length = [symbol length];
+	if (length == 0) return;
+	NSUInteger node = 0;
+	for (NSUInteger i=0; i<length; i++) {
+		unichar character = [symbol characterAtIndex:i];
+		NSUInteger child = [self childOfNode:node withCharacter:character];
+		if (child == 0) {
+			// Appending may move the array, so we only take node pointers after that.
+			child = [_nodes length] / sizeof(GBCrossReferenceMatcherNode);
+			[_nodes increaseLengthBy:sizeof(GBCrossReferenceMatcherNode)];
+			GBCrossReferenceMatcherNode *nodes = [_nodes mutableBytes];
+			nodes[child].character = character;
+			nodes[child].sibling = nodes[node].child;
+			nodes[node].child = child;
+		}
+		node = child;
+	}
+	((GBCrossReferenceMatcherNode *)[_nodes mutableBytes])[node].kinds |= kind;
+}
+
+- (NSUInteger)childOfNode:(NSUInteger)node withCharacter:(unichar)character {
+	const GBCrossReferenceMatcherNode *nodes = [_nodes bytes];
+	NSUInteger child = nodes[node].child;
+	while (child != 0 && nodes[child].character != character) child = nodes[child].sibling;
+	return child;
+}
+
+- (NSUInteger)kindsOfSymbolInCharacters:(const unichar *)chars range:(NSRange)range {
+	const GBCrossReferenceMatcherNode *nodes = [_nodes bytes];
+	NSUInteger node = 0;
+	for (NSUInteger i=range.location; i<NSMaxRange(range); i++) {
+		node = [self childOfNode:node withCharacter:chars[i]];
+		if (node == 0) return 0;
+	}
+	return nodes[node].kinds;
+}
+
+#pragma mark Matching
+
+- (NSUInteger)crossReferencesAtIndex:(NSUInteger)index ofCharacters:(const unichar *)chars length:(NSUInteger)length context:(id)context candidates:(GBCrossReference *)candidates {
+#define appendCandidate(theKind, theName) { \
+	NSUInteger linkEnd = NSMaxRange(theName); \
+	if (linkEnd < length && chars[linkEnd] == '>') linkEnd++; \
+	GBCrossReference candidate = { theKind, NSMakeRange(start, linkEnd - start), theName, NSMakeRange(0, 0) }; \
+	candidates[count++] = candidate; \
+}
+	// Skip punctuation preceeding the reference and optional < marker; the marker is part of the link text.
+	while (index < length && GBIsLeadingPunctuation(chars[index])) index++;
+	NSUInteger start = index;
+	if (index < length && chars[index] == '<') index++;
+	if (index == length || GBIsCommentLineWhitespace(chars[index])) return 0;
+
+	// Remote members are recognized by their syntax alone; if the syntax matches, the text can't be anything else.
+	unichar first = chars[index];
+	if (first == '[' || ((first == '+' || first == '-') && index + 1 < length && chars[index + 1] == '[')) {
+		if (![self scanRemoteMemberAtIndex:index ofCharacters:chars length:length toCandidate:candidates]) return 0;
+		candidates[0].range = NSMakeRange(start, NSMaxRange(candidates[0].range) - start);
+		return 1;
+	}
+
+	// Category name extends up to closing parenthesis and may contain opening one, so test it before class and protocol names.
+	NSUInteger count = 0;
+	if (first != '(') {
+		NSUInteger end = index + 1;
+		while (end < length && !GBIsCategoryNameDelimiter(chars[end])) end++;
+		if (end < length && chars[end] == ')' && end > index + 1) {
+			NSRange name = NSMakeRange(index, end + 1 - index);
+			if ([self kindsOfSymbolInCharacters:chars range:name] & GBSymbolKindCategory) appendCandidate(GBCrossReferenceKindCategory, name);
+		}
+	}
+
+	// Class and protocol names share the same syntax; selectors may additionally contain colons.
+	NSUInteger end = index;
+	while (end < length && !GBIsObjectNameDelimiter(chars[end])) end++;
+	if (end > index) {
+		NSRange name = NSMakeRange(index, end - index);
+		NSUInteger kinds = [self kindsOfSymbolInCharacters:chars range:name];
+		if (kinds & GBSymbolKindClass) appendCandidate(GBCrossReferenceKindClass, name);
+		if (kinds & GBSymbolKindProtocol) appendCandidate(GBCrossReferenceKindProtocol, name);
+	}
+	if (context) {
+		while (end < length && !GBIsSelectorDelimiter(chars[end])) end++;
+		if (end > index) {
+			NSRange name = NSMakeRange(index, end - index);
+			if (![_objectsWithSelectors containsObject:context] || ([self kindsOfSymbolInCharacters:chars range:name] & GBSymbolKindSelector)) appendCandidate(GBCrossReferenceKindLocalMember, name);
+		}
+	}
+
+	// URL is only possible if the text starts with one of the known prefixes.
+	NSUInteger urlLength = [self lengthOfURLAtIndex:index ofCharacters:chars length:length];
+	if (urlLength > 0) appendCandidate(GBCrossReferenceKindURL, NSMakeRange(index, urlLength));
+	return count;
+}
+
+- (BOOL)knowsSelectorsOfContext:(id)context {
+	return [_objectsWithSelectors containsObject:context];
+}
+
+- (BOOL)scanRemoteMemberAtIndex:(NSUInteger)index ofCharacters:(const unichar *)chars length:(NSUInteger)length toCandidate:(GBCrossReference *)candidate {
+	// Matches [+-]?\[(\S+)\s+(\S+)\]>? - object name extends to the end of the word, member name to the last closing bracket of the next word.
+	NSUInteger start = index;
+	if (chars[index] != '[') index++;
+	NSUInteger objectStart = ++index;
+	while (index < length && !GBIsCommentLineWhitespace(chars[index])) index++;
+	if (index == objectStart || index == length) return NO;
+	NSRange object = NSMakeRange(objectStart, index - objectStart);
+
+	while (index < length && GBIsCommentLineWhitespace(chars[index])) index++;
+	NSUInteger memberStart = index;
+	while (index < length && !GBIsCommentLineWhitespace(chars[index])) index++;
+	NSUInteger end = index;
+	while (end > memberStart + 1 && chars[end - 1] != ']') end--;
+	if (end <= memberStart + 1) return NO;
+	NSRange member = NSMakeRange(memberStart, end - 1 - memberStart);
+
+	if (end < length && chars[end] == '>') end++;
+	candidate->kind = GBCrossReferenceKindRemoteMember;
+	candidate->range = NSMakeRange(start, end - start);
+	candidate->name = object;
+	candidate->member = member;
+	return YES;
+}
+
+- (NSUInteger)lengthOfURLAtIndex:(NSUInteger)index ofCharacters:(const unichar *)chars length:(NSUInteger)length {
+	// Matches one of the prefixes followed by host with optional port and any number of path components.
+	NSUInteger count = sizeof(GBURLPrefixes) / sizeof(GBURLPrefixes[0]);
+	for (NSUInteger i=0; i<count; i++) {
+		const char *prefix = GBURLPrefixes[i];
+		NSUInteger end = index;
+		while (*prefix && end < length && chars[end] == (unichar)*prefix) {
+			prefix++;
+			end++;
+		}
+		if (*prefix) continue;
+
+		NSUInteger hostStart = end;
+		while (end < length && GBIsURLHostCharacter(chars[end])) end++;
+		if (end == hostStart) return 0;
+		while (end < length && chars[end] == '/') {
+			end++;
+			while (end < length && GBIsURLPathCharacter(chars[end])) end++;
+		}
+		return end - index;
+	}
+	return 0;
+}
+
+#pragma mark Properties
+
+@synthesize store = _store;
+
+@end
@@ -46,6 +46,8 @@
  
  If any kind of inconsistency is detected in source code, a warning is logged and processing continues. This allows us to extract as much information as possible, while ignoring problems.
  
+ If `[GBApplicationSettingsProvider numberOfThreads]` allows it, comments of top-level objects and their members are processed concurrently. Undocumented objects and members are removed from the store only after all comments are processed.
+ 
  @param store The store that contains all parsed objects.
  @exception NSException Thrown if a serious problem is detected which prevents us from processing.
  */
@@ -7,10 +7,15 @@
 //  Copyright (C) 2010, Gentle Bytes. All rights reserved.
 //
 
+#import <libkern/OSAtomic.h>
 #import "GBStore.h"
+#import "GBSymbolIndex.h"
 #import "GBApplicationSettingsProvider.h"
 #import "GBDataObjects.h"
+#import "GBCrossReferenceMatcher.h"
+#import "GBCommentsCache.h"
 #import "GBCommentsProcessor.h"
+#import "GBProfiler.h"
 #import "GBProcessor.h"
 
 @interface GBProcessor ()
@@ -18,10 +23,13 @@
 - (void)processClasses;
 - (void)processCategories;
 - (void)processProtocols;
+- (void)processObjectsConcurrentlyWithThreads:(NSUInteger)threads;
+- (void)processTopLevelObject:(id)object;
 - (void)processMethodsFromProvider:(GBMethodsProvider *)provider;
 - (void)processCommentForObject:(GBModelBase *)object;
 - (void)processParametersFromComment:(GBComment *)comment matchingMethod:(GBMethodData *)method;
 - (void)processHtmlReferencesForObject:(GBModelBase *)object;
+- (void)copyKnownDocumentationFromStore;
 - (void)copyKnownDocumentationForMethod:(GBMethodData *)method;
 - (BOOL)removeUndocumentedMembersAndObject:(id)object;
 
@@ -36,7 +44,9 @@
 @property (retain) GBCommentsProcessor *commentsProcessor;
 @property (retain) id<GBObjectDataProviding> currentContext;
 @property (retain) GBStore *store;
+@property (retain) GBSymbolIndex *symbolIndex;
 @property (retain) GBApplicationSettingsProvider *settings;
+@property (readonly) NSUInteger numberOfThreadsToUse;
 
 @end
 
@@ -70,9 +80,28 @@
 	self.store = store;
 	[self setupKnownObjectsFromStore];
 	[self mergeKnownCategoriesFromStore];
-	[self processClasses];
-	[self processCategories];
-	[self processProtocols];
+	self.symbolIndex = [GBSymbolIndex indexWithStore:self.store];
+	self.commentsProcessor.symbolIndex = self.symbolIndex;
+	self.commentsProcessor.crossReferenceMatcher = [GBCrossReferenceMatcher matcherWithStore:self.store];
+	self.commentsProcessor.commentsCache = [GBCommentsCache cacheWithStore:self.store];
+	[self copyKnownDocumentationFromStore];
+	NSUInteger count = [self.store.classes count] + [self.store.categories count] + [self.store.protocols count];
+	NSUInteger threads = MIN(self.numberOfThreadsToUse, count);
+	if (threads > 1) {
+		[self processObjectsConcurrentlyWithThreads:threads];
+	} else {
+		[self processClasses];
+		[self processCategories];
+		[self processProtocols];
+	}
+	GBCommentsCache *cache = self.commentsProcessor.commentsCache;
+	NSUInteger lookups = cache.numberOfHits + cache.numberOfMisses;
+	GBLogVerbose(@"Comments cache: %u hits, %u misses.", cache.numberOfHits, cache.numberOfMisses);
+	if (lookups > 0) GBProfileCount(@"cachedCommentsPercent", cache.numberOfHits * 100 / lookups);
+	self.commentsProcessor.commentsCache = nil;
+	self.commentsProcessor.crossReferenceMatcher = nil;
+	self.commentsProcessor.symbolIndex = nil;
+	self.symbolIndex = nil;
 }
 
 - (void)processClasses {
@@ -80,12 +109,8 @@
 	NSArray *classes = [self.store.classes allObjects];
 	for (GBClassData *class in classes) {
 		GBLogInfo(@"Processing class %@...", class);
-		self.currentContext = class;
-		[self validateCommentForObject:class];
-		[self processCommentForObject:class];
-		[self processMethodsFromProvider:class.methods];
+		[self processTopLevelObject:class];
 		[self removeUndocumentedMembersAndObject:class];
-		[self processHtmlReferencesForObject:class];
 		GBLogDebug(@"Finished processing class %@.", class);
 	}
 }
@@ -94,12 +119,8 @@
 	NSArray *categories = [self.store.categories allObjects];
 	for (GBCategoryData *category in categories) {
 		GBLogInfo(@"Processing category %@...", category);
-		self.currentContext = category;
-		[self validateCommentForObject:category];
-		[self processCommentForObject:category];
-		[self processMethodsFromProvider:category.methods];
+		[self processTopLevelObject:category];
 		[self removeUndocumentedMembersAndObject:category];
-		[self processHtmlReferencesForObject:category];
 		GBLogDebug(@"Finished processing category %@.", category);
 	}
 }
@@ -108,22 +129,73 @@
 	NSArray *protocols = [self.store.protocols allObjects];
 	for (GBProtocolData *protocol in protocols) {
 		GBLogInfo(@"Processing protocol %@...", protocol);
-		self.currentContext = protocol;
-		[self validateCommentForObject:protocol];
-		[self processCommentForObject:protocol];
-		[self processMethodsFromProvider:protocol.methods];
+		[self processTopLevelObject:protocol];
 		[self removeUndocumentedMembersAndObject:protocol];
-		[self processHtmlReferencesForObject:protocol];
 		GBLogDebug(@"Finished processing protocol %@.", protocol);
 	}
 }
 
+- (void)processObjectsConcurrentlyWithThreads:(NSUInteger)threads {
+	// Each worker uses its own processor with its own comments processor, as these keep the state of the object and comment being processed. While workers run, the store, symbol index and cross reference matcher are only read and the comments cache is shared; undocumented members and objects are removed afterwards, serially and in the same order as objects were taken. Known documentation was already copied, so workers never read comments other workers may be changing. Exceptions can't propagate out of GCD blocks, so we remember the first one and raise it after all workers finish.
+	NSMutableArray *objects = [NSMutableArray array];
+	[objects addObjectsFromArray:[self.store classesSortedByName]];
+	[objects addObjectsFromArray:[self.store categoriesSortedByName]];
+	[objects addObjectsFromArray:[self.store protocolsSortedByName]];
+	GBLogVerbose(@"Processing %u objects using %u threads...", [objects count], threads);
+	
+	int32_t count = (int32_t)[objects count];
+	__block int32_t lastIndex = -1;
+	__block NSException *exception = nil;
+	dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+	dispatch_apply(threads, queue, ^(size_t worker) {
+		GBProcessor *processor = [[GBProcessor alloc] initWithSettingsProvider:self.settings];
+		processor.store = self.store;
+		processor.symbolIndex = self.symbolIndex;
+		processor.commentsProcessor.symbolIndex = self.symbolIndex;
+		processor.commentsProcessor.crossReferenceMatcher = self.commentsProcessor.crossReferenceMatcher;
+		processor.commentsProcessor.commentsCache = self.commentsProcessor.commentsCache;
+		int32_t index;
+		while ((index = OSAtomicIncrement32(&lastIndex)) < count) {
+			NSAutoreleasePool *pool = [[NSAutoreleasePool alloc] init];
+			id object = [objects objectAtIndex:index];
+			@try {
+				GBLogInfo(@"Processing %@...", object);
+				[processor processTopLevelObject:object];
+				GBLogDebug(@"Finished processing %@.", object);
+			}
+			@catch (NSException *e) {
+				@synchronized(self) {
+					if (!exception) exception = [e retain];
+				}
+			}
+			[pool drain];
+		}
+		processor.commentsProcessor.commentsCache = nil;
+		processor.commentsProcessor.crossReferenceMatcher = nil;
+		processor.commentsProcessor.symbolIndex = nil;
+		[processor release];
+	});
+	if (exception) [[exception autorelease] raise];
+	
+	for (id object in objects) {
+		[self removeUndocumentedMembersAndObject:object];
+	}
+}
+
+- (void)processTopLevelObject:(id)object {
+	// Processes the given class, category or protocol and all its methods. Note that the store is not changed here, so this is safe to use from concurrent workers as long as each uses its own processor.
+	self.currentContext = object;
+	[self validateCommentForObject:object];
+	[self processCommentForObject:object];
+	[self processMethodsFromProvider:[object methods]];
+	[self processHtmlReferencesForObject:object];
+}
+
 #pragma mark Common data processing
 
 - (void)processMethodsFromProvider:(GBMethodsProvider *)provider {
 	for (GBMethodData *method in provider.methods) {
 		GBLogVerbose(@"Processing method %@...", method);
-		[self copyKnownDocumentationForMethod:method];
 		[self validateCommentForObject:method];
 		[self processCommentForObject:method];
 		[self processParametersFromComment:method.comment matchingMethod:method];
@@ -146,7 +218,9 @@
 	}
 	
 	// Let comments processor parse comment string value into object representation.
+	GBProfileBegin(commentSample);
 	[self.commentsProcessor processComment:object.comment withContext:self.currentContext store:self.store];
+	GBProfileEndObject(commentSample, kGBProfilerPhaseComments, object);
 	
 	// Prepare description paragraphs from registered paragraphs according to application settings.
 	if (!object.comment.hasParagraphs) return;
@@ -199,38 +273,32 @@
 	if ([names count] > 1) [comment replaceParametersWithParametersFromArray:sorted];
 }
 
-- (void)copyKnownDocumentationForMethod:(GBMethodData *)method {
-	// Copies method documentation from known superclasses or adopted protocols.
-	if (!self.settings.findUndocumentedMembersDocumentation || [self isCommentValid:method.comment]) return;
-	
-	// First search within superclass hierarchy. This only works for classes.
-	if ([method.parentObject isKindOfClass:[GBClassData class]]) {
-		GBClassData *class = [(GBClassData *)method.parentObject superclass];
-		while (class) {
-			GBMethodData *superMethod = [class.methods methodBySelector:method.methodSelector];
-			if (superMethod.comment) {
-				GBLogVerbose(@"Copying documentation for %@ from superclass %@...", method, class);
-				GBComment *comment = [GBComment commentWithStringValue:superMethod.comment.stringValue];
-				method.comment = comment;
-				return;
-			}
-			class = class.superclass;
-		}
-	}
-	
-	// If not found on superclass, search within adopted protocols.
-	GBAdoptedProtocolsProvider *protocols = [method.parentObject adoptedProtocols];
-	for (GBProtocolData *protocol in protocols.protocols) {
-		GBMethodData *protocolMethod = [protocol.methods methodBySelector:method.methodSelector];
-		if (protocolMethod.comment) {
-			GBLogVerbose(@"Copying documentation for %@ from adopted protocol %@...", method, protocol);
-			GBComment *comment = [GBComment commentWithStringValue:protocolMethod.comment.stringValue];
-			method.comment = comment;
-			return;
+- (void)copyKnownDocumentationFromStore {
+	// Documentation is copied for all methods before any comment is processed. This way the result doesn't depend on the order in which objects are processed and concurrent workers don't need to read comments of other objects.
+	if (!self.settings.findUndocumentedMembersDocumentation) return;
+	GBLogVerbose(@"Copying known documentation for undocumented methods...");
+	NSMutableArray *objects = [NSMutableArray array];
+	[objects addObjectsFromArray:[self.store classesSortedByName]];
+	[objects addObjectsFromArray:[self.store categoriesSortedByName]];
+	[objects addObjectsFromArray:[self.store protocolsSortedByName]];
+	for (id<GBObjectDataProviding> object in objects) {
+		for (GBMethodData *method in object.methods.methods) {
+			[self copyKnownDocumentationForMethod:method];
 		}
 	}
 }
 
+- (void)copyKnownDocumentationForMethod:(GBMethodData *)method {
+	// Copies method documentation from known superclasses or adopted protocols. Superclass hierarchy is searched first, then all protocols the object conforms to, as precomputed by symbol index.
+	if (!self.settings.findUndocumentedMembersDocumentation || [self isCommentValid:method.comment]) return;
+	id source = nil;
+	GBMethodData *inheritedMethod = [self.symbolIndex documentedMethodWithSelector:method.methodSelector inheritedByObject:method.parentObject source:&source];
+	if (!inheritedMethod) return;
+	GBLogVerbose(@"Copying documentation for %@ from %@ %@...", method, [source isKindOfClass:[GBClassData class]] ? @"superclass" : @"adopted protocol", source);
+	GBComment *comment = [GBComment commentWithStringValue:inheritedMethod.comment.stringValue];
+	method.comment = comment;
+}
+
 - (BOOL)removeUndocumentedMembersAndObject:(id)object {
 	// Removes all undocumented members from the given top-level object as well as the object itself! The result is YES if we deleted the object, NO otherwise. Note that we need to use copies of lists to prevent the actual lists being changed while we're iterating over them!
 	GBMethodsProvider *provider = [(id<GBObjectDataProviding>)object methods];
@@ -253,6 +321,7 @@
 	if (!self.settings.keepUndocumentedObjects && ![self isCommentValid:comment] && commentedMethodsCount == 0) {
 		GBLogVerbose(@"Removing undocumented object %@...", object);
 		[self.store unregisterTopLevelObject:object];
+		[self.symbolIndex removeObject:object];
 		return YES;
 	}
 	
@@ -290,15 +359,11 @@
 
 - (void)setupAdoptedProtocolsFromProvider:(GBAdoptedProtocolsProvider *)provider {
 	// This replaces known adopted protocols with real ones from the assigned store.
-	NSArray *registeredProtocols = [self.store.protocols allObjects];
 	for (GBProtocolData *adopted in [provider.protocols allObjects]) {
-		for (GBProtocolData *registered in registeredProtocols) {
-			if ([registered.nameOfProtocol isEqualToString:adopted.nameOfProtocol]) {
-				GBLogDebug(@"Replacing %@ placeholder with known data from store...", registered);
-				[provider replaceProtocol:adopted withProtocol:registered];
-				break;
-			}
-		}
+		GBProtocolData *registered = [self.store protocolWithName:adopted.nameOfProtocol];
+		if (!registered || registered == adopted) continue;
+		GBLogDebug(@"Replacing %@ placeholder with known data from store...", registered);
+		[provider replaceProtocol:adopted withProtocol:registered];
 	}
 }
 
@@ -367,11 +432,17 @@
 	return (comment && [comment.stringValue length] > 0);
 }
 
+- (NSUInteger)numberOfThreadsToUse {
+	if (self.settings.numberOfThreads == 0) return [[NSProcessInfo processInfo] activeProcessorCount];
+	return self.settings.numberOfThreads;
+}
+
 #pragma mark Properties
 
 @synthesize commentsProcessor;
 @synthesize currentContext;
 @synthesize settings;
 @synthesize store;
+@synthesize symbolIndex;
 
 @end
@@ -234,6 +234,53 @@
 	assertThatBool(settings2.prefixMergedCategoriesSectionsWithCategoryName, equalToBool(NO));
 }
 
+- (void)testThreads_shouldAssignValueToSettings {
+	// setup & execute
+	GBApplicationSettingsProvider *settings1 = [self settingsByRunningWithArgs:@"--threads", @"4", nil];
+	GBApplicationSettingsProvider *settings2 = [self settingsByRunningWithArgs:@"--threads", @"0", nil];
+	GBApplicationSettingsProvider *settings3 = [self settingsByRunningWithArgs:@"--threads", @"-2", nil];
+	// verify
+	assertThatInteger(settings1.numberOfThreads, equalToInteger(4));
+	assertThatInteger(settings2.numberOfThreads, equalToInteger(0));
+	assertThatInteger(settings3.numberOfThreads, equalToInteger(1));
+}
+
+- (void)testCacheParsedFiles_shouldAssignValueToSettings {
+	// setup & execute
+	GBApplicationSettingsProvider *settings1 = [self settingsByRunningWithArgs:@"--cache-parsed-files", nil];
+	GBApplicationSettingsProvider *settings2 = [self settingsByRunningWithArgs:@"--no-cache-parsed-files", nil];
+	// verify
+	assertThatBool(settings1.cacheParsedFiles, equalToBool(YES));
+	assertThatBool(settings2.cacheParsedFiles, equalToBool(NO));
+}
+
+- (void)testIncrementalHTML_shouldAssignValueToSettings {
+	// setup & execute
+	GBApplicationSettingsProvider *settings1 = [self settingsByRunningWithArgs:@"--incremental-html", nil];
+	GBApplicationSettingsProvider *settings2 = [self settingsByRunningWithArgs:@"--no-incremental-html", nil];
+	// verify
+	assertThatBool(settings1.incrementalHTML, equalToBool(YES));
+	assertThatBool(settings2.incrementalHTML, equalToBool(NO));
+}
+
+- (void)testUseParseKit_shouldAssignValueToSettings {
+	// setup & execute
+	GBApplicationSettingsProvider *settings1 = [self settingsByRunningWithArgs:@"--use-parsekit", nil];
+	GBApplicationSettingsProvider *settings2 = [self settingsByRunningWithArgs:@"--no-use-parsekit", nil];
+	// verify
+	assertThatBool(settings1.useParseKitTokenizer, equalToBool(YES));
+	assertThatBool(settings2.useParseKitTokenizer, equalToBool(NO));
+}
+
+- (void)testProfileReport_shouldAssignValueToSettings {
+	// setup & execute
+	GBApplicationSettingsProvider *settings1 = [self settingsByRunningWithArgs:@"--profile-report", @"path", nil];
+	GBApplicationSettingsProvider *settings2 = [self settingsByRunningWithArgs:@"--profile-report", @".", nil];
+	// verify
+	assertThat(settings1.profileReportPath, is(@"path"));
+	assertThat(settings2.profileReportPath, is(self.currentPath));
+}
+
 #pragma mark Warnings settings testing
 
 - (void)testWarnOnMissingOutputPath_shouldAssignValueToSettings {
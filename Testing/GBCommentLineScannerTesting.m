@@ -0,0 +1,73 @@
+//
+//  GBCommentLineScannerTesting.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBCommentLineScanner.h"
+
+@interface GBCommentLineScannerTesting : GHTestCase
+@end
+
+@implementation GBCommentLineScannerTesting
+
+#pragma mark Examples testing
+
+- (void)testComponentsOfLine_shouldDetectExamplePrefix {
+	// execute & verify
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"\tcode"].exampleLength, equalToInteger(1));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@" \tcode"].exampleLength, equalToInteger(2));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"    \tcode"].exampleLength, equalToInteger(4));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"   code"].exampleLength, equalToInteger(0));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"  \tcode"].exampleLength, equalToInteger(0));
+}
+
+#pragma mark Lists testing
+
+- (void)testComponentsOfLine_shouldDetectListItems {
+	// setup
+	GBCommentLine unordered = [GBCommentLineScanner componentsOfLine:@" \t- item"];
+	GBCommentLine ordered = [GBCommentLineScanner componentsOfLine:@"12.\titem"];
+	// execute & verify
+	assertThatInteger(unordered.kind, equalToInteger(GBCommentLineKindUnorderedList));
+	assertThatInteger(unordered.indentLength, equalToInteger(2));
+	assertThatInteger(unordered.descriptionLocation, equalToInteger(4));
+	assertThatInteger(ordered.kind, equalToInteger(GBCommentLineKindOrderedList));
+	assertThatInteger(ordered.indentLength, equalToInteger(0));
+	assertThatInteger(ordered.descriptionLocation, equalToInteger(4));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"-item"].kind, equalToInteger(GBCommentLineKindText));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"1 item"].kind, equalToInteger(GBCommentLineKindText));
+}
+
+#pragma mark Directives testing
+
+- (void)testComponentsOfLine_shouldDetectDirectives {
+	// execute & verify
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"@warning text"].kind, equalToInteger(GBCommentLineKindWarning));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"\\bug text"].kind, equalToInteger(GBCommentLineKindBug));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@" @return text"].kind, equalToInteger(GBCommentLineKindReturn));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"@returns text"].kind, equalToInteger(GBCommentLineKindReturn));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"@see text"].kind, equalToInteger(GBCommentLineKindCrossReference));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"@sa text"].kind, equalToInteger(GBCommentLineKindCrossReference));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"@exception name text"].kind, equalToInteger(GBCommentLineKindException));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"@warning"].kind, equalToInteger(GBCommentLineKindText));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"@returned text"].kind, equalToInteger(GBCommentLineKindText));
+}
+
+- (void)testComponentsOfLine_shouldDetectParameterNameAndDescription {
+	// setup
+	GBCommentLine line = [GBCommentLineScanner componentsOfLine:@"@param name  text"];
+	GBCommentLine lines = [GBCommentLineScanner componentsOfLine:@"@param name \n text"];
+	// execute & verify
+	assertThatInteger(line.kind, equalToInteger(GBCommentLineKindParameter));
+	assertThatInteger(line.name.location, equalToInteger(7));
+	assertThatInteger(line.name.length, equalToInteger(4));
+	assertThatInteger(line.descriptionLocation, equalToInteger(13));
+	assertThatInteger(lines.kind, equalToInteger(GBCommentLineKindParameter));
+	assertThatInteger(lines.descriptionLocation, equalToInteger(14));
+	assertThatInteger([GBCommentLineScanner componentsOfLine:@"@param name"].kind, equalToInteger(GBCommentLineKindText));
+}
+
+@end
@@ -0,0 +1,138 @@
+//
+//  GBCommentsCacheTesting.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBStore.h"
+#import "GBDataObjects.h"
+#import "GBCommentsProcessor.h"
+#import "GBCommentsCache.h"
+
+@interface GBCommentsCacheTesting : GHTestCase
+
+- (GBComment *)processedCommentWithStringValue:(NSString *)value store:(GBStore *)store;
+
+@end
+
+@implementation GBCommentsCacheTesting
+
+#pragma mark Cache handling testing
+
+- (void)testRegisterProcessedDataToComment_shouldReturnNoForUnknownText {
+	// setup
+	GBCommentsCache *cache = [GBCommentsCache cacheWithStore:[GBTestObjectsRegistry store]];
+	GBComment *comment = [GBComment commentWithStringValue:@"Text"];
+	// execute
+	BOOL result = [cache registerProcessedDataToComment:comment context:nil];
+	// verify
+	assertThatBool(result, equalToBool(NO));
+	assertThatBool(comment.hasParagraphs, equalToBool(NO));
+	assertThatInteger(cache.numberOfHits, equalToInteger(0));
+	assertThatInteger(cache.numberOfMisses, equalToInteger(1));
+}
+
+- (void)testRegisterProcessedDataToComment_shouldRegisterCachedProcessedData {
+	// setup
+	GBStore *store = [GBTestObjectsRegistry store];
+	GBCommentsCache *cache = [GBCommentsCache cacheWithStore:store];
+	GBComment *source = [self processedCommentWithStringValue:@"Text\n\n@param name Description\n@return Result\n@exception name Description\n@see http://gentlebytes.com" store:store];
+	[cache cacheProcessedDataFromComment:source context:nil dependsOnContext:NO];
+	GBComment *comment = [GBComment commentWithStringValue:source.stringValue];
+	// execute
+	BOOL result = [cache registerProcessedDataToComment:comment context:nil];
+	// verify
+	assertThatBool(result, equalToBool(YES));
+	assertThat(comment.firstParagraph, is(source.firstParagraph));
+	assertThat(comment.paragraphs, is(source.paragraphs));
+	assertThat(comment.parameters, is(source.parameters));
+	assertThat(comment.result, is(source.result));
+	assertThat(comment.exceptions, is(source.exceptions));
+	assertThat(comment.crossrefs, is(source.crossrefs));
+	assertThatInteger(cache.numberOfHits, equalToInteger(1));
+}
+
+- (void)testRegisterProcessedDataToComment_shouldShareContextDependentDataOnlyWithinSameContext {
+	// setup
+	GBClassData *class1 = [GBTestObjectsRegistry classWithName:@"Class1" methods:nil];
+	GBClassData *class2 = [GBTestObjectsRegistry classWithName:@"Class2" methods:nil];
+	GBStore *store = [GBTestObjectsRegistry storeWithObjects:class1, class2, nil];
+	GBCommentsCache *cache = [GBCommentsCache cacheWithStore:store];
+	[cache cacheProcessedDataFromComment:[self processedCommentWithStringValue:@"Text" store:store] context:class1 dependsOnContext:YES];
+	// execute & verify
+	assertThatBool([cache registerProcessedDataToComment:[GBComment commentWithStringValue:@"Text"] context:class2], equalToBool(NO));
+	assertThatBool([cache registerProcessedDataToComment:[GBComment commentWithStringValue:@"Text"] context:nil], equalToBool(NO));
+	assertThatBool([cache registerProcessedDataToComment:[GBComment commentWithStringValue:@"Text"] context:class1], equalToBool(YES));
+}
+
+- (void)testRegisterProcessedDataToComment_shouldShareIndependentDataWithContextsOfSameKind {
+	// setup
+	GBClassData *class1 = [GBTestObjectsRegistry classWithName:@"Class1" methods:nil];
+	GBClassData *class2 = [GBTestObjectsRegistry classWithName:@"Class2" methods:nil];
+	GBStore *store = [GBTestObjectsRegistry storeWithObjects:class1, class2, nil];
+	GBCommentsCache *cache = [GBCommentsCache cacheWithStore:store];
+	[cache cacheProcessedDataFromComment:[self processedCommentWithStringValue:@"Text" store:store] context:class1 dependsOnContext:NO];
+	// execute & verify
+	assertThatBool([cache registerProcessedDataToComment:[GBComment commentWithStringValue:@"Text"] context:nil], equalToBool(NO));
+	assertThatBool([cache registerProcessedDataToComment:[GBComment commentWithStringValue:@"Text"] context:class2], equalToBool(YES));
+	assertThatBool([cache registerProcessedDataToComment:[GBComment commentWithStringValue:@"Other"] context:class2], equalToBool(NO));
+}
+
+#pragma mark Comments processor integration testing
+
+- (void)testProcessComment_shouldShareProcessedDataBetweenCopies {
+	// setup
+	GBMethodData *method1 = [GBTestObjectsRegistry instanceMethodWithNames:@"method", nil];
+	GBMethodData *method2 = [GBTestObjectsRegistry instanceMethodWithNames:@"method", nil];
+	GBClassData *class1 = [GBTestObjectsRegistry classWithName:@"Class1" methods:method1, nil];
+	GBClassData *class2 = [GBTestObjectsRegistry classWithName:@"Class2" methods:method2, nil];
+	GBStore *store = [GBTestObjectsRegistry storeWithObjects:class1, class2, nil];
+	GBCommentsProcessor *processor = [GBCommentsProcessor processorWithSettingsProvider:[GBTestObjectsRegistry mockSettingsProvider]];
+	processor.commentsCache = [GBCommentsCache cacheWithStore:store];
+	GBComment *comment1 = [GBComment commentWithStringValue:@"Text"];
+	GBComment *comment2 = [GBComment commentWithStringValue:@"Text"];
+	// execute
+	[processor processComment:comment1 withContext:class1 store:store];
+	[processor processComment:comment2 withContext:class2 store:store];
+	// verify
+	assertThat(comment2.firstParagraph, is(comment1.firstParagraph));
+	assertThatInteger(processor.commentsCache.numberOfHits, equalToInteger(1));
+}
+
+- (void)testProcessComment_shouldNotShareLocalLinksBetweenContexts {
+	// setup
+	GBMethodData *method1 = [GBTestObjectsRegistry instanceMethodWithNames:@"method", nil];
+	GBMethodData *method2 = [GBTestObjectsRegistry instanceMethodWithNames:@"method", nil];
+	GBClassData *class1 = [GBTestObjectsRegistry classWithName:@"Class1" methods:method1, nil];
+	GBClassData *class2 = [GBTestObjectsRegistry classWithName:@"Class2" methods:method2, nil];
+	GBStore *store = [GBTestObjectsRegistry storeWithObjects:class1, class2, nil];
+	GBCommentsProcessor *processor = [GBCommentsProcessor processorWithSettingsProvider:[GBTestObjectsRegistry mockSettingsProvider]];
+	processor.commentsCache = [GBCommentsCache cacheWithStore:store];
+	GBComment *comment1 = [GBComment commentWithStringValue:@"method:"];
+	GBComment *comment2 = [GBComment commentWithStringValue:@"method:"];
+	GBComment *comment3 = [GBComment commentWithStringValue:@"method:"];
+	// execute
+	[processor processComment:comment1 withContext:class1 store:store];
+	[processor processComment:comment2 withContext:class2 store:store];
+	[processor processComment:comment3 withContext:class1 store:store];
+	// verify
+	GBParagraphLinkItem *link1 = [comment1.firstParagraph.paragraphItems objectAtIndex:0];
+	GBParagraphLinkItem *link2 = [comment2.firstParagraph.paragraphItems objectAtIndex:0];
+	assertThat(link1.member, is(method1));
+	assertThat(link2.member, is(method2));
+	assertThat(comment3.firstParagraph, is(comment1.firstParagraph));
+	assertThatInteger(processor.commentsCache.numberOfHits, equalToInteger(1));
+}
+
+#pragma mark Creation methods
+
+- (GBComment *)processedCommentWithStringValue:(NSString *)value store:(GBStore *)store {
+	GBCommentsProcessor *processor = [GBCommentsProcessor processorWithSettingsProvider:[GBTestObjectsRegistry mockSettingsProvider]];
+	GBComment *result = [GBComment commentWithStringValue:value];
+	[processor processComment:result withStore:store];
+	return result;
+}
+
+@end
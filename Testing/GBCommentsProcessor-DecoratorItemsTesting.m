@@ -416,5 +416,19 @@
 	 [GBParagraphTextItem class], GBDecorationTypeNone, @"bold_italics*with star", nil];
 }
 
+- (void)testProcesCommentWithStore_shouldKeepUnpairedMarkersAsText {
+	// setup
+	GBCommentsProcessor *processor = [GBCommentsProcessor processorWithSettingsProvider:[GBTestObjectsRegistry mockSettingsProvider]];
+	GBComment *comment = [GBComment commentWithStringValue:@"`code*_` and *bold* with value*_name and prefix_"];
+	// execute
+	[processor processComment:comment withStore:[GBTestObjectsRegistry store]];
+	// verify
+	[self assertParagraph:[comment.paragraphs objectAtIndex:0] containsItems:
+	 [GBParagraphDecoratorItem class], @"code*_",
+	 [GBParagraphTextItem class], @" and ",
+	 [GBParagraphDecoratorItem class], @"bold",
+	 [GBParagraphTextItem class], @" with value*_name and prefix_", nil];
+}
+
 @end
 
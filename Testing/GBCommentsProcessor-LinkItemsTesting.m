@@ -62,6 +62,21 @@
 	[self assertParagraph:[comment.paragraphs objectAtIndex:0] containsItems:[GBParagraphTextItem class], @"prefix ", [GBParagraphLinkItem class], @"http://gentlebytes.com", [GBParagraphTextItem class], @" suffix", nil];
 }
 
+- (void)testProcesCommentWithStore_shouldDetectAllLinksWithinParagraph {
+	// setup
+	GBCommentsProcessor *processor = [GBCommentsProcessor processorWithSettingsProvider:[GBTestObjectsRegistry mockSettingsProvider]];
+	GBMethodData *method = [GBTestObjectsRegistry instanceMethodWithNames:@"instance", nil];
+	GBClassData *class = [GBTestObjectsRegistry classWithName:@"Class" methods:method, nil];
+	GBStore *store = [GBTestObjectsRegistry storeByPerformingSelector:@selector(registerClass:) withObject:class];
+	GBComment *comment = [GBComment commentWithStringValue:@"See Class and [Class instance:] or http://gentlebytes.com"];
+	// execute
+	[processor processComment:comment withStore:store];
+	// verify
+	Class text = [GBParagraphTextItem class];
+	Class link = [GBParagraphLinkItem class];
+	[self assertParagraph:[comment.paragraphs objectAtIndex:0] containsItems:text, @"See ", link, @"Class", text, @" and ", link, @"[Class instance:]", text, @" or ", link, @"http://gentlebytes.com", nil];
+}
+
 #pragma mark URL processing testing
 
 - (void)testProcessCommentWithStore_url_shouldDetectVariousPrefixes {
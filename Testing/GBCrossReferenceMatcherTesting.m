@@ -0,0 +1,105 @@
+//
+//  GBCrossReferenceMatcherTesting.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBDataObjects.h"
+#import "GBStore.h"
+#import "GBCrossReferenceMatcher.h"
+
+@interface GBCrossReferenceMatcherTesting : GHTestCase
+
+- (NSUInteger)matcher:(GBCrossReferenceMatcher *)matcher crossReferencesInString:(NSString *)string context:(id)context candidates:(GBCrossReference *)candidates;
+
+@end
+
+@implementation GBCrossReferenceMatcherTesting
+
+#pragma mark Objects testing
+
+- (void)testCrossReferencesAtIndex_shouldMatchKnownObjects {
+	// setup
+	GBClassData *class = [GBTestObjectsRegistry classWithName:@"Class" methods:nil];
+	GBCategoryData *category = [GBTestObjectsRegistry categoryWithName:@"Category" className:@"Class" methods:nil];
+	GBStore *store = [GBTestObjectsRegistry storeWithObjects:class, category, nil];
+	GBCrossReferenceMatcher *matcher = [GBCrossReferenceMatcher matcherWithStore:store];
+	GBCrossReference candidates[GBCrossReferenceMaximumCandidates];
+	// execute & verify
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"Class(Category)." context:nil candidates:candidates], equalToInteger(2));
+	assertThatInteger(candidates[0].kind, equalToInteger(GBCrossReferenceKindCategory));
+	assertThatInteger(candidates[0].range.length, equalToInteger(15));
+	assertThatInteger(candidates[1].kind, equalToInteger(GBCrossReferenceKindClass));
+	assertThatInteger(candidates[1].range.length, equalToInteger(5));
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"(<Class>)" context:nil candidates:candidates], equalToInteger(1));
+	assertThatInteger(candidates[0].range.location, equalToInteger(1));
+	assertThatInteger(candidates[0].range.length, equalToInteger(7));
+	assertThatInteger(candidates[0].name.location, equalToInteger(2));
+	assertThatInteger(candidates[0].name.length, equalToInteger(5));
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"Classes" context:nil candidates:candidates], equalToInteger(0));
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"Cla" context:nil candidates:candidates], equalToInteger(0));
+}
+
+#pragma mark Members testing
+
+- (void)testCrossReferencesAtIndex_shouldMatchRemoteMembersBySyntax {
+	// setup
+	GBCrossReferenceMatcher *matcher = [GBCrossReferenceMatcher matcherWithStore:[GBTestObjectsRegistry store]];
+	GBCrossReference candidates[GBCrossReferenceMaximumCandidates];
+	// execute & verify
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"<-[Object method:]>." context:nil candidates:candidates], equalToInteger(1));
+	assertThatInteger(candidates[0].kind, equalToInteger(GBCrossReferenceKindRemoteMember));
+	assertThatInteger(candidates[0].range.length, equalToInteger(19));
+	assertThatInteger(candidates[0].name.location, equalToInteger(3));
+	assertThatInteger(candidates[0].name.length, equalToInteger(6));
+	assertThatInteger(candidates[0].member.location, equalToInteger(10));
+	assertThatInteger(candidates[0].member.length, equalToInteger(7));
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"[Object]" context:nil candidates:candidates], equalToInteger(0));
+}
+
+- (void)testCrossReferencesAtIndex_shouldMatchKnownSelectorsOfRegisteredContext {
+	// setup
+	GBMethodData *method = [GBTestObjectsRegistry instanceMethodWithNames:@"instance", nil];
+	GBClassData *class = [GBTestObjectsRegistry classWithName:@"Class" methods:method, nil];
+	GBClassData *unregistered = [GBTestObjectsRegistry classWithName:@"Other" methods:nil];
+	GBStore *store = [GBTestObjectsRegistry storeByPerformingSelector:@selector(registerClass:) withObject:class];
+	GBCrossReferenceMatcher *matcher = [GBCrossReferenceMatcher matcherWithStore:store];
+	GBCrossReference candidates[GBCrossReferenceMaximumCandidates];
+	// execute & verify
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"instance:," context:class candidates:candidates], equalToInteger(1));
+	assertThatInteger(candidates[0].kind, equalToInteger(GBCrossReferenceKindLocalMember));
+	assertThatInteger(candidates[0].name.length, equalToInteger(9));
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"instance:" context:nil candidates:candidates], equalToInteger(0));
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"other:" context:class candidates:candidates], equalToInteger(0));
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"other:" context:unregistered candidates:candidates], equalToInteger(1));
+}
+
+#pragma mark URL testing
+
+- (void)testCrossReferencesAtIndex_shouldMatchURLsWithKnownPrefixes {
+	// setup
+	GBCrossReferenceMatcher *matcher = [GBCrossReferenceMatcher matcherWithStore:[GBTestObjectsRegistry store]];
+	GBCrossReference candidates[GBCrossReferenceMaximumCandidates];
+	// execute & verify
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"<https://gentlebytes.com:80/a/b?c=1>" context:nil candidates:candidates], equalToInteger(1));
+	assertThatInteger(candidates[0].kind, equalToInteger(GBCrossReferenceKindURL));
+	assertThatInteger(candidates[0].range.length, equalToInteger(36));
+	assertThatInteger(candidates[0].name.location, equalToInteger(1));
+	assertThatInteger(candidates[0].name.length, equalToInteger(34));
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"mailto:tomaz@gentlebytes.com" context:nil candidates:candidates], equalToInteger(1));
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"htp://gentlebytes.com" context:nil candidates:candidates], equalToInteger(0));
+	assertThatInteger([self matcher:matcher crossReferencesInString:@"http://" context:nil candidates:candidates], equalToInteger(0));
+}
+
+#pragma mark Creation methods
+
+- (NSUInteger)matcher:(GBCrossReferenceMatcher *)matcher crossReferencesInString:(NSString *)string context:(id)context candidates:(GBCrossReference *)candidates {
+	NSUInteger length = [string length];
+	NSMutableData *data = [NSMutableData dataWithLength:length * sizeof(unichar)];
+	[string getCharacters:[data mutableBytes] range:NSMakeRange(0, length)];
+	return [matcher crossReferencesAtIndex:0 ofCharacters:[data bytes] length:length context:context candidates:candidates];
+}
+
+@end
@@ -0,0 +1,121 @@
+//
+//  GBHTMLOutputGeneratorTesting.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBApplicationSettingsProvider.h"
+#import "GBStore.h"
+#import "GBDataObjects.h"
+#import "GBHTMLOutputGenerator.h"
+
+@interface GBHTMLOutputGeneratorTesting : GHTestCase
+
+- (GBStore *)fixtureStoreWithCount:(NSUInteger)count;
+- (NSString *)outputPathByGeneratingStore:(GBStore *)store threads:(NSUInteger)threads;
+- (GBApplicationSettingsProvider *)settingsWithOutputPath:(NSString *)path threads:(NSUInteger)threads;
+- (NSString *)templatesPath;
+
+@end
+
+@implementation GBHTMLOutputGeneratorTesting
+
+#pragma mark Concurrency testing
+
+- (void)testGenerateOutputWithStore_shouldWriteSameFilesRegardlessOfNumberOfThreads {
+	// setup
+	GBStore *store = [self fixtureStoreWithCount:12];
+	NSFileManager *manager = [NSFileManager defaultManager];
+	// execute
+	NSString *expectedPath = [self outputPathByGeneratingStore:store threads:1];
+	NSString *path1 = [self outputPathByGeneratingStore:store threads:2];
+	NSString *path2 = [self outputPathByGeneratingStore:store threads:8];
+	// verify
+	NSArray *expected = [[manager subpathsOfDirectoryAtPath:expectedPath error:nil] sortedArrayUsingSelector:@selector(compare:)];
+	assertThatBool([expected containsObject:@"Classes/Class11.html"], equalToBool(YES));
+	assertThatBool([expected containsObject:@"Categories/Class11(Category).html"], equalToBool(YES));
+	assertThatBool([expected containsObject:@"Protocols/Protocol11.html"], equalToBool(YES));
+	assertThat([[manager subpathsOfDirectoryAtPath:path1 error:nil] sortedArrayUsingSelector:@selector(compare:)], equalTo(expected));
+	assertThat([[manager subpathsOfDirectoryAtPath:path2 error:nil] sortedArrayUsingSelector:@selector(compare:)], equalTo(expected));
+	for (NSString *subpath in expected) {
+		NSData *data = [NSData dataWithContentsOfFile:[expectedPath stringByAppendingPathComponent:subpath]];
+		if (!data) continue;
+		assertThat([NSData dataWithContentsOfFile:[path1 stringByAppendingPathComponent:subpath]], equalTo(data));
+		assertThat([NSData dataWithContentsOfFile:[path2 stringByAppendingPathComponent:subpath]], equalTo(data));
+	}
+	[manager removeItemAtPath:[expectedPath stringByDeletingLastPathComponent] error:nil];
+	[manager removeItemAtPath:[path1 stringByDeletingLastPathComponent] error:nil];
+	[manager removeItemAtPath:[path2 stringByDeletingLastPathComponent] error:nil];
+}
+
+#pragma mark Incremental output testing
+
+- (void)testGenerateOutputWithStore_shouldRemoveStaticFilesNoLongerInTemplates {
+	// setup
+	NSFileManager *manager = [NSFileManager defaultManager];
+	NSString *root = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSProcessInfo processInfo] globallyUniqueString]];
+	NSString *templates = [root stringByAppendingPathComponent:@"Templates"];
+	[manager copyItemAtPath:[self templatesPath] toPath:templates error:nil];
+	[@"body { }" writeToFile:[templates stringByAppendingPathComponent:@"html/css/removed.css"] atomically:NO encoding:NSUTF8StringEncoding error:nil];
+	GBApplicationSettingsProvider *settings = [self settingsWithOutputPath:[root stringByAppendingPathComponent:@"Output"] threads:1];
+	settings.templatesPath = templates;
+	settings.incrementalHTML = YES;
+	GBStore *store = [self fixtureStoreWithCount:1];
+	GBHTMLOutputGenerator *generator1 = [GBHTMLOutputGenerator generatorWithSettingsProvider:settings];
+	[generator1 copyTemplateFilesToOutputPath:nil];
+	[generator1 generateOutputWithStore:store error:nil];
+	NSString *path = [[generator1.outputUserPath stringByStandardizingPath] stringByAppendingPathComponent:@"css/removed.css"];
+	assertThatBool([manager fileExistsAtPath:path], equalToBool(YES));
+	[manager removeItemAtPath:[templates stringByAppendingPathComponent:@"html/css/removed.css"] error:nil];
+	// execute
+	GBHTMLOutputGenerator *generator2 = [GBHTMLOutputGenerator generatorWithSettingsProvider:settings];
+	[generator2 copyTemplateFilesToOutputPath:nil];
+	[generator2 generateOutputWithStore:store error:nil];
+	// verify
+	assertThatBool([manager fileExistsAtPath:path], equalToBool(NO));
+	assertThatBool([manager fileExistsAtPath:[[generator2.outputUserPath stringByStandardizingPath] stringByAppendingPathComponent:@"Classes/Class0.html"]], equalToBool(YES));
+	[manager removeItemAtPath:root error:nil];
+}
+
+#pragma mark Creation methods
+
+- (GBStore *)fixtureStoreWithCount:(NSUInteger)count {
+	GBStore *result = [GBTestObjectsRegistry store];
+	for (NSUInteger i=0; i<count; i++) {
+		NSString *name = [NSString stringWithFormat:@"Class%u", i];
+		GBMethodData *method = [GBTestObjectsRegistry instanceMethodWithNames:@"method", @"value", nil];
+		GBMethodData *property = [GBTestObjectsRegistry propertyMethodWithArgument:@"value"];
+		GBClassData *class = [GBTestObjectsRegistry classWithName:name methods:method, property, nil];
+		class.comment = [GBComment commentWithStringValue:name];
+		[result registerClass:class];
+		[result registerCategory:[GBTestObjectsRegistry categoryWithName:@"Category" className:name methods:[GBTestObjectsRegistry classMethodWithNames:@"category", nil], nil]];
+		[result registerProtocol:[GBTestObjectsRegistry protocolWithName:[NSString stringWithFormat:@"Protocol%u", i] methods:[GBTestObjectsRegistry instanceMethodWithNames:@"protocol", nil], nil]];
+	}
+	return result;
+}
+
+- (NSString *)outputPathByGeneratingStore:(GBStore *)store threads:(NSUInteger)threads {
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSProcessInfo processInfo] globallyUniqueString]];
+	GBApplicationSettingsProvider *settings = [self settingsWithOutputPath:path threads:threads];
+	GBHTMLOutputGenerator *generator = [GBHTMLOutputGenerator generatorWithSettingsProvider:settings];
+	[generator copyTemplateFilesToOutputPath:nil];
+	[generator generateOutputWithStore:store error:nil];
+	return [generator.outputUserPath stringByStandardizingPath];
+}
+
+- (GBApplicationSettingsProvider *)settingsWithOutputPath:(NSString *)path threads:(NSUInteger)threads {
+	GBApplicationSettingsProvider *result = [GBTestObjectsRegistry realSettingsProvider];
+	result.templatesPath = [self templatesPath];
+	result.outputPath = path;
+	result.numberOfThreads = threads;
+	return result;
+}
+
+- (NSString *)templatesPath {
+	NSString *root = [[[NSString stringWithUTF8String:__FILE__] stringByDeletingLastPathComponent] stringByDeletingLastPathComponent];
+	return [root stringByAppendingPathComponent:@"Templates"];
+}
+
+@end
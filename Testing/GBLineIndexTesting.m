@@ -0,0 +1,38 @@
+//
+//  GBLineIndexTesting.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBLineIndex.h"
+
+@interface GBLineIndexTesting : GHTestCase
+@end
+
+@implementation GBLineIndexTesting
+
+#pragma mark Line numbers testing
+
+- (void)testLineNumberAtOffset_shouldReturnSameValueAsNumberOfLinesInRange {
+	// setup
+	NSString *string = @"line1\nline2\r\nline3\n\nline5";
+	GBLineIndex *index = [GBLineIndex indexWithString:string];
+	// execute & verify
+	for (NSUInteger offset=0; offset<=[string length]; offset++) {
+		NSUInteger expected = [string numberOfLinesInRange:NSMakeRange(0, offset)];
+		assertThatInteger([index lineNumberAtOffset:offset], equalToInteger(expected));
+	}
+}
+
+- (void)testLineNumberAtOffset_shouldReturnNotFoundForInvalidOffset {
+	// setup
+	GBLineIndex *index = [GBLineIndex indexWithString:@"line1\nline2"];
+	// execute & verify
+	assertThatInteger([index lineNumberAtOffset:NSNotFound], equalToInteger(NSNotFound));
+	assertThatInteger([index lineNumberAtOffset:12], equalToInteger(NSNotFound));
+	assertThatInteger([index lineNumberAtOffset:11], equalToInteger(2));
+}
+
+@end
@@ -526,6 +526,49 @@
 	assertThatInteger([provider.sections count], equalToInteger(0));
 }
 
+- (void)testUnregisterMethod_shouldAllowRegisteringMethodAgain {
+	// setup
+	GBMethodsProvider *provider = [[GBMethodsProvider alloc] initWithParentObject:self];
+	GBMethodData *method1 = [GBTestObjectsRegistry instanceMethodWithNames:@"method1", nil];
+	GBMethodData *method2 = [GBTestObjectsRegistry instanceMethodWithNames:@"method2", nil];
+	[provider registerMethod:method1];
+	[provider registerMethod:method2];
+	// execute
+	[provider unregisterMethod:method1];
+	[provider registerMethod:method1];
+	// verify
+	assertThatInteger([provider.methods count], equalToInteger(2));
+	assertThat([provider.methods objectAtIndex:0], is(method2));
+	assertThat([provider.methods objectAtIndex:1], is(method1));
+	assertThatInteger([provider.instanceMethods count], equalToInteger(2));
+	assertThat([provider.instanceMethods objectAtIndex:0], is(method1));
+}
+
+- (void)testUnregisterMethod_shouldHandleLargeNumberOfMethods {
+	// setup - methods are registered in shuffled order; with re-sorting on each registration and linear removals this took several seconds.
+	GBMethodsProvider *provider = [[GBMethodsProvider alloc] initWithParentObject:self];
+	NSUInteger count = 10000;
+	NSMutableArray *methods = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger i=0; i<count; i++) {
+		NSString *name = [NSString stringWithFormat:@"method%05u", (i * 7919) % count];
+		GBMethodData *method = [GBTestObjectsRegistry instanceMethodWithNames:name, nil];
+		[methods addObject:method];
+		[provider registerMethod:method];
+	}
+	// execute
+	for (NSUInteger i=0; i<count; i+=2) [provider unregisterMethod:[methods objectAtIndex:i]];
+	// verify
+	assertThatInteger([provider.methods count], equalToInteger(count / 2));
+	assertThat([provider.methods objectAtIndex:0], is([methods objectAtIndex:1]));
+	assertThatInteger([provider.instanceMethods count], equalToInteger(count / 2));
+	for (NSUInteger i=1; i<[provider.instanceMethods count]; i++) {
+		NSString *previous = [[provider.instanceMethods objectAtIndex:i-1] methodSelector];
+		NSString *current = [[provider.instanceMethods objectAtIndex:i] methodSelector];
+		assertThatInteger([previous compare:current], equalToInteger(NSOrderedAscending));
+	}
+	assertThatInteger([[[provider.sections objectAtIndex:0] methods] count], equalToInteger(count / 2));
+}
+
 #pragma mark Helper methods testing
 
 - (void)testMethodBySelector_shouldReturnProperInstanceOrNil {
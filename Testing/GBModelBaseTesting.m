@@ -55,6 +55,34 @@
 	assertThatInteger([[files objectAtIndex:1] lineNumber], equalToInteger(1));
 }
 
+#pragma mark Source information registration testing
+
+- (void)testRegisterSourceInfo_shouldReplaceSourceInfoWithSameFilename {
+	// setup
+	GBModelBase *object = [[GBModelBase alloc] init];
+	[object registerSourceInfo:[GBSourceInfo infoWithFilename:@"f1" lineNumber:1]];
+	// execute
+	[object registerSourceInfo:[GBSourceInfo infoWithFilename:@"f1" lineNumber:2]];
+	// verify
+	NSArray *files = [object sourceInfosSortedByName];
+	assertThatInteger([files count], equalToInteger(1));
+	assertThatInteger([[files objectAtIndex:0] lineNumber], equalToInteger(2));
+}
+
+- (void)testRegisterSourceInfo_shouldKeepSourceInfosWithDifferentFilenames {
+	// setup
+	GBModelBase *object = [[GBModelBase alloc] init];
+	[object registerSourceInfo:[GBSourceInfo infoWithFilename:@"f1" lineNumber:1]];
+	[object registerSourceInfo:[GBSourceInfo infoWithFilename:@"f2" lineNumber:2]];
+	// execute
+	[object registerSourceInfo:[GBSourceInfo infoWithFilename:@"f1" lineNumber:3]];
+	// verify
+	NSArray *files = [object sourceInfosSortedByName];
+	assertThatInteger([files count], equalToInteger(2));
+	assertThatInteger([[files objectAtIndex:0] lineNumber], equalToInteger(3));
+	assertThatInteger([[files objectAtIndex:1] lineNumber], equalToInteger(2));
+}
+
 #pragma mark Comments merging handling
 
 - (void)testMergeDataFromObject_shouldUseOriginalCommentIfSourceIsNotGiven {
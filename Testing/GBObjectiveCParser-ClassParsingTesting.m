@@ -55,6 +55,19 @@
 	assertThatInteger([[files anyObject] lineNumber], equalToInteger(7));
 }
 
+- (void)testParseObjectsFromData_shouldRegisterClassDefinitionWithComment {
+	// setup
+	GBObjectiveCParser *parser = [GBObjectiveCParser parserWithSettingsProvider:[GBTestObjectsRegistry mockSettingsProvider]];
+	GBStore *store = [[GBStore alloc] init];
+	NSData *data = [@"\n/// Comment \u010D\n@interface MyClass @end" dataUsingEncoding:NSUTF8StringEncoding];
+	// execute
+	[parser parseObjectsFromData:data sourceFile:@"filename.h" toStore:store];
+	// verify
+	GBClassData *class = [store classWithName:@"MyClass"];
+	assertThat([class.comment stringValue], is(@"Comment \u010D"));
+	assertThatInteger([[class.sourceInfos anyObject] lineNumber], equalToInteger(3));
+}
+
 - (void)testParseObjectsFromString_shouldRegisterAllClassDefinitions {
 	// setup
 	GBObjectiveCParser *parser = [GBObjectiveCParser parserWithSettingsProvider:[GBTestObjectsRegistry mockSettingsProvider]];
@@ -380,4 +393,17 @@
 	assertThatInteger([class.methods.methods count], equalToInteger(1));
 }
 
+#pragma mark Source contents testing
+
+- (void)testContentsOfSourceData_shouldDetectObjects {
+	// setup
+	NSData *(^data)(NSString *) = ^(NSString *string) { return [string dataUsingEncoding:NSUTF8StringEncoding]; };
+	// execute & verify
+	assertThatInteger([GBObjectiveCParser contentsOfSourceData:data(@"")], equalToInteger(0));
+	assertThatInteger([GBObjectiveCParser contentsOfSourceData:data(@"// Comment\n/* Comment */\n@end @interfac")], equalToInteger(0));
+	assertThatInteger([GBObjectiveCParser contentsOfSourceData:data(@"@interface Class @end")], equalToInteger(GBSourceContentsObjects));
+	assertThatInteger([GBObjectiveCParser contentsOfSourceData:data(@"@ @protocol Protocol @end")], equalToInteger(GBSourceContentsObjects));
+	assertThatInteger([GBObjectiveCParser contentsOfSourceData:data(@"@implementation Class @end")], equalToInteger(GBSourceContentsObjects));
+}
+
 @end
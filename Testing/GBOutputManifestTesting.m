@@ -0,0 +1,180 @@
+//
+//  GBOutputManifestTesting.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBDataObjects.h"
+#import "GBOutputManifest.h"
+
+@interface GBOutputManifestTesting : GHTestCase
+
+- (GBOutputManifest *)manifest;
+- (NSDictionary *)variablesForObject:(id)object;
+
+@end
+
+@implementation GBOutputManifestTesting
+
+#pragma mark Digest testing
+
+- (void)testDigestForVariables_shouldReturnSameDigestForEqualVariables {
+	// setup
+	GBOutputManifest *manifest = [self manifest];
+	GBClassData *class1 = [GBTestObjectsRegistry classWithName:@"Class" methods:[GBTestObjectsRegistry instanceMethodWithNames:@"method", nil], nil];
+	GBClassData *class2 = [GBTestObjectsRegistry classWithName:@"Class" methods:[GBTestObjectsRegistry instanceMethodWithNames:@"method", nil], nil];
+	class1.comment = [GBComment commentWithStringValue:@"Comment"];
+	class2.comment = [GBComment commentWithStringValue:@"Comment"];
+	// execute
+	NSString *digest1 = [manifest digestForVariables:[self variablesForObject:class1] object:class1 template:@"template"];
+	NSString *digest2 = [manifest digestForVariables:[self variablesForObject:class2] object:class2 template:@"template"];
+	// verify
+	assertThat(digest1, is(digest2));
+}
+
+- (void)testDigestForVariables_shouldReturnDifferentDigestIfObjectDataChanges {
+	// setup
+	GBOutputManifest *manifest = [self manifest];
+	GBClassData *class1 = [GBTestObjectsRegistry classWithName:@"Class" methods:[GBTestObjectsRegistry instanceMethodWithNames:@"method", nil], nil];
+	GBClassData *class2 = [GBTestObjectsRegistry classWithName:@"Class" methods:[GBTestObjectsRegistry instanceMethodWithNames:@"method", nil], nil];
+	GBClassData *class3 = [GBTestObjectsRegistry classWithName:@"Class" methods:[GBTestObjectsRegistry instanceMethodWithNames:@"method2", nil], nil];
+	class1.comment = [GBComment commentWithStringValue:@"Comment"];
+	class2.comment = [GBComment commentWithStringValue:@"Changed"];
+	class3.comment = [GBComment commentWithStringValue:@"Comment"];
+	// execute
+	NSString *digest1 = [manifest digestForVariables:[self variablesForObject:class1] object:class1 template:@"template"];
+	NSString *digest2 = [manifest digestForVariables:[self variablesForObject:class2] object:class2 template:@"template"];
+	NSString *digest3 = [manifest digestForVariables:[self variablesForObject:class3] object:class3 template:@"template"];
+	// verify
+	assertThat(digest1, isNot(digest2));
+	assertThat(digest1, isNot(digest3));
+}
+
+- (void)testDigestForVariables_shouldReturnDifferentDigestIfTemplateChanges {
+	// setup
+	GBOutputManifest *manifest = [self manifest];
+	GBClassData *class = [GBClassData classDataWithName:@"Class"];
+	NSDictionary *vars = [self variablesForObject:class];
+	// execute
+	NSString *digest1 = [manifest digestForVariables:vars object:class template:@"template1"];
+	NSString *digest2 = [manifest digestForVariables:vars object:class template:@"template2"];
+	// verify
+	assertThat(digest1, isNot(digest2));
+}
+
+- (void)testDigestForVariables_shouldIgnoreContentsOfOtherTopLevelObjects {
+	// setup
+	GBOutputManifest *manifest = [self manifest];
+	GBClassData *superclass = [GBClassData classDataWithName:@"Superclass"];
+	GBClassData *class = [GBClassData classDataWithName:@"Class"];
+	class.superclass = superclass;
+	NSString *digest1 = [manifest digestForVariables:[self variablesForObject:class] object:class template:@"template"];
+	// execute
+	superclass.comment = [GBComment commentWithStringValue:@"Comment"];
+	NSString *digest2 = [manifest digestForVariables:[self variablesForObject:class] object:class template:@"template"];
+	// verify
+	assertThat(digest1, is(digest2));
+}
+
+- (void)testDigestForVariables_shouldIgnoreDataNotRenderedByTemplates {
+	// setup
+	GBOutputManifest *manifest = [self manifest];
+	GBClassData *class = [GBTestObjectsRegistry classWithName:@"Class" methods:[GBTestObjectsRegistry instanceMethodWithNames:@"method", nil], nil];
+	NSString *digest1 = [manifest digestForVariables:[self variablesForObject:class] object:class template:@"template"];
+	// execute
+	[class.ivars registerIvar:[GBTestObjectsRegistry ivarWithComponents:@"int", @"_value", nil]];
+	NSString *digest2 = [manifest digestForVariables:[self variablesForObject:class] object:class template:@"template"];
+	// verify
+	assertThat(digest1, is(digest2));
+}
+
+- (void)testDigestForVariables_shouldReturnDifferentDigestIfProcessedCommentChanges {
+	// setup
+	GBOutputManifest *manifest = [self manifest];
+	GBClassData *class = [GBClassData classDataWithName:@"Class"];
+	class.comment = [GBComment commentWithStringValue:@"Comment"];
+	NSString *digest1 = [manifest digestForVariables:[self variablesForObject:class] object:class template:@"template"];
+	// execute
+	[class.comment registerParagraph:[GBCommentParagraph paragraph]];
+	NSString *digest2 = [manifest digestForVariables:[self variablesForObject:class] object:class template:@"template"];
+	// verify
+	assertThat(digest1, isNot(digest2));
+}
+
+#pragma mark Pages handling testing
+
+- (void)testIsPageUpToDateWithDigest_shouldReturnNoForUnknownPage {
+	// setup
+	GBOutputManifest *manifest = [self manifest];
+	// execute & verify
+	assertThatBool([manifest isPage:@"Classes/Class.html" upToDateWithDigest:@"digest"], equalToBool(NO));
+}
+
+- (void)testIsPageUpToDateWithDigest_shouldCompareDigestsFromPreviousRun {
+	// setup
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"GBOutputManifestTesting.plist"];
+	GBOutputManifest *manifest1 = [self manifest];
+	GBOutputManifest *manifest2 = [self manifest];
+	[manifest1 isPage:@"Classes/Class1.html" upToDateWithDigest:@"digest1"];
+	[manifest1 isPage:@"Classes/Class2.html" upToDateWithDigest:@"digest2"];
+	[manifest1 writeToFile:path error:nil];
+	// execute
+	[manifest2 loadFromFile:path];
+	BOOL result1 = [manifest2 isPage:@"Classes/Class1.html" upToDateWithDigest:@"digest1"];
+	BOOL result2 = [manifest2 isPage:@"Classes/Class2.html" upToDateWithDigest:@"changed"];
+	// verify
+	assertThatBool(result1, equalToBool(YES));
+	assertThatBool(result2, equalToBool(NO));
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+- (void)testStalePages_shouldReturnPagesNotRegisteredDuringRun {
+	// setup
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"GBOutputManifestTesting.plist"];
+	GBOutputManifest *manifest1 = [self manifest];
+	GBOutputManifest *manifest2 = [self manifest];
+	[manifest1 isPage:@"Classes/Class1.html" upToDateWithDigest:@"digest1"];
+	[manifest1 isPage:@"Classes/Class2.html" upToDateWithDigest:@"digest2"];
+	[manifest1 writeToFile:path error:nil];
+	[manifest2 loadFromFile:path];
+	// execute
+	[manifest2 isPage:@"Classes/Class1.html" upToDateWithDigest:@"digest1"];
+	NSArray *pages = manifest2.stalePages;
+	// verify
+	assertThatInteger([pages count], equalToInteger(1));
+	assertThat([pages objectAtIndex:0], is(@"Classes/Class2.html"));
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+- (void)testStalePages_shouldReturnFilesNotRegisteredDuringRun {
+	// setup
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"GBOutputManifestTesting.plist"];
+	GBOutputManifest *manifest1 = [self manifest];
+	GBOutputManifest *manifest2 = [self manifest];
+	[manifest1 registerFile:@"css/styles.css"];
+	[manifest1 registerFile:@"css/removed.css"];
+	[manifest1 writeToFile:path error:nil];
+	[manifest2 loadFromFile:path];
+	// execute
+	[manifest2 registerFile:@"css/styles.css"];
+	NSArray *pages = manifest2.stalePages;
+	// verify
+	assertThatInteger([pages count], equalToInteger(1));
+	assertThat([pages objectAtIndex:0], is(@"css/removed.css"));
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+#pragma mark Creation methods
+
+- (GBOutputManifest *)manifest {
+	return [GBOutputManifest manifestWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+}
+
+- (NSDictionary *)variablesForObject:(id)object {
+	NSDictionary *page = [NSDictionary dictionaryWithObjectsAndKeys:[object description], @"title", nil];
+	return [NSDictionary dictionaryWithObjectsAndKeys:page, @"page", object, @"object", nil];
+}
+
+@end
@@ -0,0 +1,205 @@
+//
+//  GBParserCacheTesting.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBStore.h"
+#import "GBDataObjects.h"
+#import "GBObjectiveCParser.h"
+#import "GBParserCache.h"
+
+@interface GBParserCacheTesting : GBObjectsAssertor
+
+- (GBStore *)storeByParsingString:(NSString *)string;
+- (NSData *)dataFromString:(NSString *)string;
+- (NSDictionary *)cachedDataFromStore:(GBStore *)store;
+
+@end
+
+@implementation GBParserCacheTesting
+
+#pragma mark Cache handling testing
+
+- (void)testRegisterObjectsForFile_shouldReturnNoForUnknownFile {
+	// setup
+	GBParserCache *cache = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	GBStore *store = [[GBStore alloc] init];
+	// execute
+	BOOL result = [cache registerObjectsForFile:@"file.h" data:[self dataFromString:@"source"] toStore:store];
+	// verify
+	assertThatBool(result, equalToBool(NO));
+	assertThatInteger([store.classes count], equalToInteger(0));
+	assertThatInteger(cache.numberOfHits, equalToInteger(0));
+	assertThatInteger(cache.numberOfMisses, equalToInteger(1));
+}
+
+- (void)testRegisterObjectsForFile_shouldReturnNoIfDataChanged {
+	// setup
+	GBParserCache *cache = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	GBStore *source = [self storeByParsingString:@"@interface MyClass @end"];
+	[cache cacheObjectsFromStore:source forFile:@"file.h" data:[self dataFromString:@"@interface MyClass @end"]];
+	GBStore *store = [[GBStore alloc] init];
+	// execute
+	BOOL result = [cache registerObjectsForFile:@"file.h" data:[self dataFromString:@"@interface MyClass2 @end"] toStore:store];
+	// verify
+	assertThatBool(result, equalToBool(NO));
+	assertThatInteger([store.classes count], equalToInteger(0));
+	assertThatInteger(cache.numberOfMisses, equalToInteger(1));
+}
+
+- (void)testRegisterObjectsForFile_shouldRegisterCachedTopLevelObjects {
+	// setup
+	NSString *input = @"@interface MyClass : NSObject <MyProtocol> @end @interface MyClass (MyCategory) @end @interface MyClass () @end @protocol MyProtocol @end";
+	GBParserCache *cache = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	[cache cacheObjectsFromStore:[self storeByParsingString:input] forFile:@"file.h" data:[self dataFromString:input]];
+	GBStore *store = [[GBStore alloc] init];
+	// execute
+	BOOL result = [cache registerObjectsForFile:@"file.h" data:[self dataFromString:input] toStore:store];
+	// verify
+	assertThatBool(result, equalToBool(YES));
+	assertThatInteger(cache.numberOfHits, equalToInteger(1));
+	GBClassData *class = [store classWithName:@"MyClass"];
+	assertThat(class.nameOfSuperclass, is(@"NSObject"));
+	assertThatInteger([class.sourceInfos count], equalToInteger(1));
+	assertThat([[class.sourceInfos anyObject] filename], is(@"file"));
+	assertThatInteger([[class.sourceInfos anyObject] lineNumber], equalToInteger(1));
+	assertThatInteger([class.adoptedProtocols.protocols count], equalToInteger(1));
+	assertThat([[class.adoptedProtocols.protocols anyObject] nameOfProtocol], is(@"MyProtocol"));
+	assertThat([store categoryWithName:@"MyClass(MyCategory)"], isNot(nil));
+	assertThat([store categoryWithName:@"MyClass()"], isNot(nil));
+	assertThat([store protocolWithName:@"MyProtocol"], isNot(nil));
+}
+
+- (void)testRegisterObjectsForFile_shouldRegisterCachedMethodsAndSections {
+	// setup
+	NSString *input = @"@interface MyClass /** @name Section1 */ /** Comment1 */ -(id)method1:(int)var1; /** @name Section2 */ /** Comment2 */ @property (readonly) NSString *value; -(id)method2:(id)var2,... NS_REQUIRES_NIL_TERMINATION; @end";
+	GBParserCache *cache = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	[cache cacheObjectsFromStore:[self storeByParsingString:input] forFile:@"file.h" data:[self dataFromString:input]];
+	GBStore *store = [[GBStore alloc] init];
+	// execute
+	[cache registerObjectsForFile:@"file.h" data:[self dataFromString:input] toStore:store];
+	// verify
+	NSArray *sections = [[[store classWithName:@"MyClass"] methods] sections];
+	assertThatInteger([sections count], equalToInteger(2));
+	GBMethodSectionData *section1 = [sections objectAtIndex:0];
+	GBMethodSectionData *section2 = [sections objectAtIndex:1];
+	assertThat(section1.sectionName, is(@"Section1"));
+	assertThat(section2.sectionName, is(@"Section2"));
+	assertThatInteger([section1.methods count], equalToInteger(1));
+	assertThatInteger([section2.methods count], equalToInteger(2));
+	[self assertMethod:[section1.methods objectAtIndex:0] matchesInstanceComponents:@"id", @"method1", @"int", @"var1", nil];
+	[self assertMethod:[section2.methods objectAtIndex:0] matchesPropertyComponents:@"readonly", @"NSString", @"*", @"value", nil];
+	assertThat([[[section1.methods objectAtIndex:0] comment] stringValue], is(@"Comment1"));
+	assertThat([[[section2.methods objectAtIndex:0] comment] stringValue], is(@"Comment2"));
+	GBMethodArgument *argument = [[[section2.methods objectAtIndex:1] methodArguments] lastObject];
+	assertThatBool(argument.isVariableArg, equalToBool(YES));
+	assertThatInteger([argument.terminationMacros count], equalToInteger(1));
+	assertThat([argument.terminationMacros objectAtIndex:0], is(@"NS_REQUIRES_NIL_TERMINATION"));
+}
+
+- (void)testRegisterObjectsForFile_shouldRegisterCachedIvars {
+	// setup
+	GBIvarData *ivar1 = [GBTestObjectsRegistry ivarWithComponents:@"int", @"_ivar1", nil];
+	GBIvarData *ivar2 = [GBTestObjectsRegistry ivarWithComponents:@"NSString", @"*", @"_ivar2", nil];
+	[ivar1 setComment:[GBComment commentWithStringValue:@"Comment1"]];
+	[ivar2 registerSourceInfo:[GBSourceInfo infoWithFilename:@"file" lineNumber:2]];
+	GBClassData *class = [GBClassData classDataWithName:@"MyClass"];
+	[class.ivars registerIvar:ivar1];
+	[class.ivars registerIvar:ivar2];
+	GBParserCache *cache = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	[cache cacheObjectsFromStore:[GBTestObjectsRegistry storeWithObjects:class, nil] forFile:@"file.h" data:[self dataFromString:@"source"]];
+	GBStore *store = [[GBStore alloc] init];
+	// execute
+	[cache registerObjectsForFile:@"file.h" data:[self dataFromString:@"source"] toStore:store];
+	// verify
+	NSArray *ivars = [[[store classWithName:@"MyClass"] ivars] ivars];
+	assertThatInteger([ivars count], equalToInteger(2));
+	[self assertIvar:[ivars objectAtIndex:0] matches:@"int", @"_ivar1", nil];
+	[self assertIvar:[ivars objectAtIndex:1] matches:@"NSString", @"*", @"_ivar2", nil];
+	assertThat([[[ivars objectAtIndex:0] comment] stringValue], is(@"Comment1"));
+	assertThatInteger([[[ivars objectAtIndex:1] sourceInfos] count], equalToInteger(1));
+	assertThatInteger([[[[ivars objectAtIndex:1] sourceInfos] anyObject] lineNumber], equalToInteger(2));
+}
+
+- (void)testRegisterObjectsForFile_shouldRegisterSameDataAsParsing {
+	// setup
+	NSString *input = @"/** Class */ @interface MyClass : NSObject <MyProtocol> /** @name Section */ /** Method */ -(id)method:(int)var; /** Property */ @property (retain) id value; @end /** Category */ @interface MyClass (MyCategory) +(void)category; @end /** Protocol */ @protocol MyProtocol @optional -(void)optional; @end";
+	GBStore *expected = [self storeByParsingString:input];
+	GBParserCache *cache = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	[cache cacheObjectsFromStore:expected forFile:@"file.h" data:[self dataFromString:input]];
+	GBStore *store = [[GBStore alloc] init];
+	// execute
+	[cache registerObjectsForFile:@"file.h" data:[self dataFromString:input] toStore:store];
+	// verify
+	assertThat([self cachedDataFromStore:store], equalTo([self cachedDataFromStore:expected]));
+}
+
+#pragma mark Persistence testing
+
+- (void)testWriteToFile_shouldAllowLoadingCachedObjects {
+	// setup
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"GBParserCacheTesting.plist"];
+	NSString *input = @"@interface MyClass @end";
+	GBParserCache *cache1 = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	GBParserCache *cache2 = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	[cache1 cacheObjectsFromStore:[self storeByParsingString:input] forFile:@"file.h" data:[self dataFromString:input]];
+	GBStore *store = [[GBStore alloc] init];
+	// execute
+	BOOL written = [cache1 writeToFile:path error:nil];
+	[cache2 loadFromFile:path];
+	BOOL result = [cache2 registerObjectsForFile:@"file.h" data:[self dataFromString:input] toStore:store];
+	// verify
+	assertThatBool(written, equalToBool(YES));
+	assertThatBool(result, equalToBool(YES));
+	assertThat([store classWithName:@"MyClass"], isNot(nil));
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+- (void)testWriteToFile_shouldOnlyWriteEntriesUsedDuringRun {
+	// setup
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"GBParserCacheTesting.plist"];
+	NSString *input = @"@interface MyClass @end";
+	GBParserCache *cache1 = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	GBParserCache *cache2 = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	GBParserCache *cache3 = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	[cache1 cacheObjectsFromStore:[self storeByParsingString:input] forFile:@"file1.h" data:[self dataFromString:input]];
+	[cache1 cacheObjectsFromStore:[self storeByParsingString:input] forFile:@"file2.h" data:[self dataFromString:input]];
+	[cache1 writeToFile:path error:nil];
+	[cache2 loadFromFile:path];
+	[cache2 registerObjectsForFile:@"file1.h" data:[self dataFromString:input] toStore:[[GBStore alloc] init]];
+	// execute
+	[cache2 writeToFile:path error:nil];
+	[cache3 loadFromFile:path];
+	// verify
+	assertThatBool([cache3 registerObjectsForFile:@"file1.h" data:[self dataFromString:input] toStore:[[GBStore alloc] init]], equalToBool(YES));
+	assertThatBool([cache3 registerObjectsForFile:@"file2.h" data:[self dataFromString:input] toStore:[[GBStore alloc] init]], equalToBool(NO));
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+#pragma mark Creation methods
+
+- (GBStore *)storeByParsingString:(NSString *)string {
+	GBObjectiveCParser *parser = [GBObjectiveCParser parserWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	GBStore *result = [[GBStore alloc] init];
+	[parser parseObjectsFromString:string sourceFile:@"file" toStore:result];
+	return result;
+}
+
+- (NSData *)dataFromString:(NSString *)string {
+	return [string dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (NSDictionary *)cachedDataFromStore:(GBStore *)store {
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"GBParserCacheTesting.plist"];
+	GBParserCache *cache = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	[cache cacheObjectsFromStore:store forFile:@"file.h" data:[NSData data]];
+	[cache writeToFile:path error:nil];
+	NSDictionary *result = [[NSDictionary dictionaryWithContentsOfFile:path] objectForKey:@"entries"];
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+	return [result objectForKey:@"file.h"];
+}
+
+@end
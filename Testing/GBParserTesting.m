@@ -0,0 +1,118 @@
+//
+//  GBParserTesting.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBApplicationSettingsProvider.h"
+#import "GBStore.h"
+#import "GBDataObjects.h"
+#import "GBParser.h"
+#import "GBParserCache.h"
+
+@interface GBParserTesting : GHTestCase
+
+- (NSString *)temporaryDirectoryWithFiles:(NSDictionary *)files;
+- (NSDictionary *)fixtureFilesWithCount:(NSUInteger)count;
+- (GBStore *)storeByParsingPath:(NSString *)path threads:(NSUInteger)threads;
+- (NSDictionary *)cachedDataFromStore:(GBStore *)store;
+
+@end
+
+@implementation GBParserTesting
+
+#pragma mark Skipping testing
+
+- (void)testParseObjectsFromPaths_shouldMergeUndocumentedImplementationToDocumentedHeader {
+	// setup
+	GBApplicationSettingsProvider *settings = [GBTestObjectsRegistry realSettingsProvider];
+	settings.keepUndocumentedObjects = NO;
+	settings.keepUndocumentedMembers = NO;
+	settings.findUndocumentedMembersDocumentation = NO;
+	settings.cacheParsedFiles = NO;
+	settings.numberOfThreads = 1;
+	NSString *path = [self temporaryDirectoryWithFiles:[NSDictionary dictionaryWithObjectsAndKeys:
+		@"/** Comment */\n@interface Foo : NSObject\n/** Comment */\n- (void)method;\n@end", @"Foo.h",
+		@"@interface Foo ()\n- (void)extension;\n@end\n@implementation Foo\n- (void)method { }\n@end", @"Foo.m",
+		@"// Nothing to parse.", @"Other.m",
+		nil]];
+	GBParser *parser = [GBParser parserWithSettingsProvider:settings];
+	GBStore *store = [[[GBStore alloc] init] autorelease];
+	// execute
+	[parser parseObjectsFromPaths:[NSArray arrayWithObject:path] toStore:store];
+	// verify
+	GBClassData *class = [store classWithName:@"Foo"];
+	NSArray *infos = [class sourceInfosSortedByName];
+	assertThatInteger([infos count], equalToInteger(2));
+	assertThat([[infos objectAtIndex:0] filename], is(@"Foo.h"));
+	assertThat([[infos objectAtIndex:1] filename], is(@"Foo.m"));
+	assertThatInteger([store.categories count], equalToInteger(1));
+	assertThatInteger(parser.numberOfSkippedFiles, equalToInteger(1));
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+#pragma mark Concurrency testing
+
+- (void)testParseObjectsFromPaths_shouldGiveSameStoreRegardlessOfNumberOfThreads {
+	// setup
+	NSString *path = [self temporaryDirectoryWithFiles:[self fixtureFilesWithCount:12]];
+	NSDictionary *expected = [self cachedDataFromStore:[self storeByParsingPath:path threads:1]];
+	// execute & verify
+	assertThatInteger([[expected objectForKey:@"classes"] count], equalToInteger(12));
+	assertThat([self cachedDataFromStore:[self storeByParsingPath:path threads:2]], equalTo(expected));
+	assertThat([self cachedDataFromStore:[self storeByParsingPath:path threads:8]], equalTo(expected));
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+#pragma mark Creation methods
+
+- (NSDictionary *)fixtureFilesWithCount:(NSUInteger)count {
+	// Each class is split over a header, an implementation with class extension and a category in another directory, with members declared in all of them, so merging order affects the result. A protocol adopted by all classes is declared in yet another directory.
+	NSMutableDictionary *result = [NSMutableDictionary dictionaryWithCapacity:count * 3 + 1];
+	[result setObject:@"/** Protocol */\n@protocol Shared\n/** Required */\n- (void)shared;\n@optional\n/** Optional */\n- (void)optional;\n@end" forKey:@"Protocols/Shared.h"];
+	for (NSUInteger i=0; i<count; i++) {
+		NSString *header = [NSString stringWithFormat:@"/** Class %1$u */\n@interface Class%1$u : NSObject <Shared> {\n\tid _value;\n}\n/** @name Section */\n/** Method */\n- (void)method%1$u:(id)value;\n/** Property */\n@property (retain) id value;\n@end", i];
+		NSString *source = [NSString stringWithFormat:@"@interface Class%1$u ()\n/** Extension */\n- (void)extension;\n@end\n@implementation Class%1$u\n/** Implementation */\n- (void)method%1$u:(id)value { }\n- (void)shared { }\n@end", i];
+		NSString *category = [NSString stringWithFormat:@"/** Category */\n@interface Class%1$u (Category)\n/** Category method */\n+ (id)category%1$u;\n@end", i];
+		[result setObject:header forKey:[NSString stringWithFormat:@"Headers/Class%u.h", i]];
+		[result setObject:source forKey:[NSString stringWithFormat:@"Sources/Class%u.m", i]];
+		[result setObject:category forKey:[NSString stringWithFormat:@"Sources/Categories/Class%u+Category.h", i]];
+	}
+	return result;
+}
+
+- (GBStore *)storeByParsingPath:(NSString *)path threads:(NSUInteger)threads {
+	GBApplicationSettingsProvider *settings = [GBTestObjectsRegistry realSettingsProvider];
+	settings.cacheParsedFiles = NO;
+	settings.numberOfThreads = threads;
+	GBParser *parser = [GBParser parserWithSettingsProvider:settings];
+	GBStore *result = [[[GBStore alloc] init] autorelease];
+	[parser parseObjectsFromPaths:[NSArray arrayWithObject:path] toStore:result];
+	return result;
+}
+
+- (NSDictionary *)cachedDataFromStore:(GBStore *)store {
+	// Parser cache encodes all parsed data in a deterministic order, so we can compare stores by their cached representation.
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSProcessInfo processInfo] globallyUniqueString]];
+	GBParserCache *cache = [GBParserCache cacheWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	[cache cacheObjectsFromStore:store forFile:@"store" data:[NSData data]];
+	[cache writeToFile:path error:nil];
+	NSDictionary *result = [[NSDictionary dictionaryWithContentsOfFile:path] objectForKey:@"entries"];
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+	return [result objectForKey:@"store"];
+}
+
+- (NSString *)temporaryDirectoryWithFiles:(NSDictionary *)files {
+	NSString *result = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSProcessInfo processInfo] globallyUniqueString]];
+	[[NSFileManager defaultManager] createDirectoryAtPath:result withIntermediateDirectories:YES attributes:nil error:nil];
+	[files enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSString *contents, BOOL *stop) {
+		NSString *filename = [result stringByAppendingPathComponent:name];
+		[[NSFileManager defaultManager] createDirectoryAtPath:[filename stringByDeletingLastPathComponent] withIntermediateDirectories:YES attributes:nil error:nil];
+		[contents writeToFile:filename atomically:NO encoding:NSUTF8StringEncoding error:nil];
+	}];
+	return result;
+}
+
+@end
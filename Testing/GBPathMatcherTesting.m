@@ -0,0 +1,46 @@
+//
+//  GBPathMatcherTesting.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBPathMatcher.h"
+
+@interface GBPathMatcherTesting : GHTestCase
+@end
+
+@implementation GBPathMatcherTesting
+
+#pragma mark Matching testing
+
+- (void)testMatchesPath_shouldMatchAnySuffix {
+	// setup
+	GBPathMatcher *matcher = [GBPathMatcher matcherWithSuffixes:[NSArray arrayWithObjects:@"/Libraries", @"Private.h", @"s.h", nil]];
+	// execute & verify
+	assertThatBool([matcher matchesPath:@"/project/Libraries"], equalToBool(YES));
+	assertThatBool([matcher matchesPath:@"/project/Source/Private.h"], equalToBool(YES));
+	assertThatBool([matcher matchesPath:@"/project/Source/Class.h"], equalToBool(NO));
+	assertThatBool([matcher matchesPath:@"/project/Source/Classes.h"], equalToBool(YES));
+	assertThatBool([matcher matchesPath:@"/project/Libraries/Class.h"], equalToBool(NO));
+	assertThatBool([matcher matchesPath:@"Libraries"], equalToBool(NO));
+}
+
+- (void)testMatchesPath_shouldMatchNonASCIISuffixes {
+	// setup
+	GBPathMatcher *matcher = [GBPathMatcher matcherWithSuffixes:[NSArray arrayWithObject:@"\u010Dasi.h"]];
+	// execute & verify
+	assertThatBool([matcher matchesPath:@"/project/\u010Dasi.h"], equalToBool(YES));
+	assertThatBool([matcher matchesPath:@"/project/casi.h"], equalToBool(NO));
+}
+
+- (void)testMatchesPath_shouldNeverMatchEmptySuffix {
+	// setup
+	GBPathMatcher *matcher = [GBPathMatcher matcherWithSuffixes:[NSArray arrayWithObject:@""]];
+	// execute & verify
+	assertThatBool([matcher matchesPath:@"/project/Class.h"], equalToBool(NO));
+	assertThatBool([matcher matchesPath:@""], equalToBool(NO));
+}
+
+@end
@@ -118,6 +118,21 @@
 	assertThat(derived.comment, isNot(nil));
 }
 
+- (void)testProcessObjectsFromStore_shouldCopyDocumentationFromProtocolAdoptedBySuperclass {
+	// setup
+	GBMethodData *original = [self instanceMethodWithName:@"method" comment:@"comment"];
+	GBProtocolData *protocol = [self protocolWithName:@"Protocol" method:original];
+	GBClassData *superclass = [self classWithName:@"Superclass" adopting:protocol method:nil];
+	GBMethodData *derived = [self instanceMethodWithName:@"method" comment:nil];
+	GBClassData *class = [self classWithName:@"Class" superclass:@"Superclass" method:derived];
+	GBStore *store = [GBTestObjectsRegistry storeWithObjects:class, superclass, protocol, nil];
+	GBProcessor *processor = [self processorWithFind:YES];
+	// execute
+	[processor processObjectsFromStore:store];
+	// verify
+	assertThat([derived.comment stringValue], is([original.comment stringValue]));
+}
+
 #pragma mark Creation methods
 
 - (GBClassData *)classWithName:(NSString *)name superclass:(NSString *)superclass method:(id)method {
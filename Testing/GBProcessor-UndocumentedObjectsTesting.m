@@ -6,6 +6,7 @@
 //  Copyright (C) 2010 Gentle Bytes. All rights reserved.
 //
 
+#import "GBApplicationSettingsProvider.h"
 #import "GBDataObjects.h"
 #import "GBStore.h"
 #import "GBProcessor.h"
@@ -135,6 +136,33 @@
 	assertThatBool([store.classes containsObject:class], equalToBool(NO));
 }
 
+#pragma mark Concurrent processing handling
+
+- (void)testProcessObjectsFromStore_shouldDeleteUncommentedObjectsAndMethodsWhenUsingMultipleThreads {
+	// setup
+	GBApplicationSettingsProvider *settings = [GBApplicationSettingsProvider provider];
+	settings.keepUndocumentedObjects = NO;
+	settings.keepUndocumentedMembers = NO;
+	settings.numberOfThreads = 4;
+	GBProcessor *processor = [GBProcessor processorWithSettingsProvider:settings];
+	GBStore *store = [[GBStore alloc] init];
+	for (NSUInteger i=0; i<20; i++) {
+		GBClassData *class = [self classWithComment:(i % 2 == 0)];
+		[self registerMethodsOfCount:(i % 2 == 0) ? 1 : 0 withComment:YES toObject:class];
+		[self registerMethodsOfCount:1 withComment:NO toObject:class];
+		[store registerClass:class];
+	}
+	// execute
+	[processor processObjectsFromStore:store];
+	// verify
+	assertThatInteger([store.classes count], equalToInteger(10));
+	for (GBClassData *class in store.classes) {
+		assertThat(class.comment, isNot(nil));
+		assertThatInteger([class.methods.methods count], equalToInteger(1));
+		assertThat(class.htmlReferenceName, isNot(nil));
+	}
+}
+
 #pragma mark Creation methods
 
 - (OCMockObject *)settingsProviderKeepObjects:(BOOL)objects keepMembers:(BOOL)members {
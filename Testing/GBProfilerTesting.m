@@ -0,0 +1,81 @@
+//
+//  GBProfilerTesting.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBProfiler.h"
+
+@interface GBProfilerTesting : GHTestCase
+
+- (NSString *)reportByRecordingWithProfiler:(GBProfiler *)profiler usingBlock:(void (^)(void))block;
+
+@end
+
+@implementation GBProfilerTesting
+
+#pragma mark Sampling testing
+
+- (void)testSampleNow_shouldReturnZeroSampleIfDisabled {
+	// setup
+	[GBProfiler setEnabled:NO];
+	// execute
+	GBProfilerSample sample = GBProfilerSampleNow();
+	// verify
+	assertThatInteger(sample.wallTime, equalToInteger(0));
+	assertThatInteger(sample.cpuTime, equalToInteger(0));
+}
+
+#pragma mark Reporting testing
+
+- (void)testWriteReportToFile_shouldWritePhasesAndCounters {
+	// setup
+	GBProfiler *profiler = [[GBProfiler alloc] init];
+	// execute
+	NSString *report = [self reportByRecordingWithProfiler:profiler usingBlock:^{
+		GBProfilerSample sample = GBProfilerSampleNow();
+		[profiler recordPhase:@"phase1" sinceSample:sample];
+		[profiler recordPhase:@"phase1" sinceSample:sample];
+		[profiler incrementCounter:@"counter1" by:2];
+		[profiler incrementCounter:@"counter1" by:3];
+	}];
+	// verify
+	assertThatBool([report hasPrefix:@"{"], equalToBool(YES));
+	assertThat(report, containsString(@"\"phases\":{\"phase1\":{\"count\":2,"));
+	assertThat(report, containsString(@"\"counters\":{\"counter1\":5}"));
+	assertThat(report, containsString(@"\"peakResidentSize\":"));
+}
+
+- (void)testWriteReportToFile_shouldWriteSlowestFilesAndObjects {
+	// setup
+	GBProfiler *profiler = [[GBProfiler alloc] init];
+	profiler.maximumNumberOfSlowestItems = 1;
+	// execute
+	NSString *report = [self reportByRecordingWithProfiler:profiler usingBlock:^{
+		GBProfilerSample sample = GBProfilerSampleNow();
+		[profiler recordPhase:@"phase1" sinceSample:sample file:@"file1.h"];
+		[profiler recordPhase:@"phase1" sinceSample:GBProfilerSampleNow() file:@"file2.h"];
+		[profiler recordPhase:@"phase2" sinceSample:sample object:@"Object \"1\""];
+	}];
+	// verify
+	assertThat(report, containsString(@"\"slowestFiles\":[{\"name\":\"file1.h\","));
+	assertThat(report, isNot(containsString(@"file2.h")));
+	assertThat(report, containsString(@"\"slowestObjects\":[{\"name\":\"Object \\\"1\\\"\","));
+}
+
+#pragma mark Creation methods
+
+- (NSString *)reportByRecordingWithProfiler:(GBProfiler *)profiler usingBlock:(void (^)(void))block {
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"GBProfilerTesting.json"];
+	[GBProfiler setEnabled:YES];
+	block();
+	[GBProfiler setEnabled:NO];
+	[profiler writeReportToFile:path error:nil];
+	NSString *result = [NSString stringWithContentsOfFile:path encoding:NSUTF8StringEncoding error:nil];
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+	return result;
+}
+
+@end
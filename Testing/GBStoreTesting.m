@@ -236,6 +236,43 @@
 	assertThat([store protocolWithName:nil], is(nil));
 }
 
+#pragma mark Store registration testing
+
+- (void)testRegisterObjectsFromStore_shouldAddAllObjectsToList {
+	// setup
+	GBStore *source = [[GBStore alloc] init];
+	GBClassData *class = [GBClassData classDataWithName:@"MyClass"];
+	GBCategoryData *category = [GBCategoryData categoryDataWithName:@"MyCategory" className:@"MyClass"];
+	GBProtocolData *protocol = [GBProtocolData protocolDataWithName:@"MyProtocol"];
+	[source registerClass:class];
+	[source registerCategory:category];
+	[source registerProtocol:protocol];
+	GBStore *store = [[GBStore alloc] init];
+	// execute
+	[store registerObjectsFromStore:source];
+	// verify
+	assertThat([store classWithName:@"MyClass"], is(class));
+	assertThat([store categoryWithName:@"MyClass(MyCategory)"], is(category));
+	assertThat([store protocolWithName:@"MyProtocol"], is(protocol));
+}
+
+- (void)testRegisterObjectsFromStore_shouldMergeDataFromInstancesOfSameName {
+	// setup
+	GBStore *source = [[GBStore alloc] init];
+	GBClassData *class2 = [GBClassData classDataWithName:@"MyClass"];
+	[source registerClass:class2];
+	GBStore *store = [[GBStore alloc] init];
+	OCMockObject *class1 = [OCMockObject niceMockForClass:[GBClassData class]];
+	[[[class1 stub] andReturn:@"MyClass"] nameOfClass];
+	[[class1 expect] mergeDataFromObject:class2];
+	[store registerClass:(GBClassData *)class1];
+	// execute
+	[store registerObjectsFromStore:source];
+	// verify
+	assertThatInteger([store.classes count], equalToInteger(1));
+	[class1 verify];
+}
+
 #pragma mark Unregistration testing
 
 - (void)testUnregisterTopLevelObject_shouldRemoveClass {
@@ -0,0 +1,90 @@
+//
+//  GBSymbolIndexTesting.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBDataObjects.h"
+#import "GBStore.h"
+#import "GBSymbolIndex.h"
+
+@interface GBSymbolIndexTesting : GHTestCase
+@end
+
+@implementation GBSymbolIndexTesting
+
+#pragma mark Objects handling testing
+
+- (void)testObjectWithName_shouldPreferClassesToCategoriesAndProtocols {
+	// setup
+	GBClassData *class = [GBClassData classDataWithName:@"NSObject"];
+	GBProtocolData *protocol = [GBProtocolData protocolDataWithName:@"NSObject"];
+	GBCategoryData *category = [GBCategoryData categoryDataWithName:@"Category" className:@"NSObject"];
+	GBStore *store = [GBTestObjectsRegistry storeWithObjects:protocol, category, class, nil];
+	// execute
+	GBSymbolIndex *index = [GBSymbolIndex indexWithStore:store];
+	// verify
+	assertThat([index objectWithName:@"NSObject"], is(class));
+	assertThat([index objectWithName:@"NSObject(Category)"], is(category));
+	assertThat([index classWithName:@"NSObject"], is(class));
+	assertThat([index protocolWithName:@"NSObject"], is(protocol));
+	assertThat([index categoryWithName:@"NSObject(Category)"], is(category));
+	assertThat([index objectWithName:@"Unknown"], is(nil));
+}
+
+- (void)testRemoveObject_shouldFallBackToRemainingObjectWithSameName {
+	// setup
+	GBClassData *class = [GBClassData classDataWithName:@"NSObject"];
+	GBProtocolData *protocol = [GBProtocolData protocolDataWithName:@"NSObject"];
+	GBSymbolIndex *index = [GBSymbolIndex indexWithStore:[GBTestObjectsRegistry storeWithObjects:class, protocol, nil]];
+	// execute
+	[index removeObject:class];
+	// verify
+	assertThat([index classWithName:@"NSObject"], is(nil));
+	assertThat([index objectWithName:@"NSObject"], is(protocol));
+}
+
+#pragma mark Relations handling testing
+
+- (void)testSuperclassesOfClass_shouldReturnKnownHierarchyAndStopOnCycles {
+	// setup
+	GBClassData *base = [GBClassData classDataWithName:@"Base"];
+	GBClassData *middle = [GBClassData classDataWithName:@"Middle"];
+	GBClassData *class = [GBClassData classDataWithName:@"Class"];
+	class.superclass = middle;
+	middle.superclass = base;
+	base.superclass = middle;
+	// execute
+	GBSymbolIndex *index = [GBSymbolIndex indexWithStore:[GBTestObjectsRegistry storeWithObjects:base, middle, class, nil]];
+	// verify
+	NSArray *superclasses = [index superclassesOfClass:class];
+	assertThatInteger([superclasses count], equalToInteger(2));
+	assertThat([superclasses objectAtIndex:0], is(middle));
+	assertThat([superclasses objectAtIndex:1], is(base));
+}
+
+- (void)testProtocolsOfObject_shouldReturnAdoptedInheritedAndSuperclassProtocols {
+	// setup
+	GBProtocolData *base = [GBProtocolData protocolDataWithName:@"Base"];
+	GBProtocolData *derived = [GBProtocolData protocolDataWithName:@"Derived"];
+	GBProtocolData *other = [GBProtocolData protocolDataWithName:@"Other"];
+	[derived.adoptedProtocols registerProtocol:base];
+	[base.adoptedProtocols registerProtocol:derived];
+	GBClassData *superclass = [GBClassData classDataWithName:@"Superclass"];
+	[superclass.adoptedProtocols registerProtocol:other];
+	GBClassData *class = [GBClassData classDataWithName:@"Class"];
+	[class.adoptedProtocols registerProtocol:derived];
+	class.superclass = superclass;
+	// execute
+	GBSymbolIndex *index = [GBSymbolIndex indexWithStore:[GBTestObjectsRegistry storeWithObjects:base, derived, other, superclass, class, nil]];
+	// verify
+	NSArray *protocols = [index protocolsOfObject:class];
+	assertThatInteger([protocols count], equalToInteger(3));
+	assertThat([protocols objectAtIndex:0], is(derived));
+	assertThat([protocols objectAtIndex:1], is(base));
+	assertThat([protocols objectAtIndex:2], is(other));
+}
+
+@end
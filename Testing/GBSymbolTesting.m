@@ -0,0 +1,56 @@
+//
+//  GBSymbolTesting.m
+//  appledoc
+//
+//  Created by agent on 16.10.26.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import "GBSymbol.h"
+#import "GBDataObjects.h"
+
+@interface GBSymbolTesting : GHTestCase
+@end
+
+@implementation GBSymbolTesting
+
+#pragma mark Symbols handling testing
+
+- (void)testSymbolWithString_shouldReturnSameInstanceForEqualStrings {
+	// setup
+	NSString *string1 = [NSMutableString stringWithString:@"Symbol"];
+	NSString *string2 = [NSMutableString stringWithString:@"Symbol"];
+	// execute
+	NSString *symbol1 = [GBSymbol symbolWithString:string1];
+	NSString *symbol2 = [GBSymbol symbolWithString:string2];
+	// verify
+	assertThatBool(symbol1 == symbol2, equalToBool(YES));
+	assertThatBool([GBSymbol symbolWithString:symbol1] == symbol1, equalToBool(YES));
+	assertThat([GBSymbol symbolWithString:nil], is(nil));
+}
+
+- (void)testSymbolWithString_shouldBehaveAsOrdinaryString {
+	// setup & execute
+	NSString *symbol = [GBSymbol symbolWithString:@"Symbol"];
+	NSDictionary *dictionary = [NSDictionary dictionaryWithObject:@"value" forKey:symbol];
+	// verify
+	assertThat(symbol, is(@"Symbol"));
+	assertThatBool([@"Symbol" isEqualToString:symbol], equalToBool(YES));
+	assertThatBool([symbol isEqual:[GBSymbol symbolWithString:@"Other"]], equalToBool(NO));
+	assertThatInteger([symbol hash], equalToInteger([@"Symbol" hash]));
+	assertThat([dictionary objectForKey:@"Symbol"], is(@"value"));
+	assertThat([NSString stringWithFormat:@"[%@]", symbol], is(@"[Symbol]"));
+}
+
+- (void)testModelObjects_shouldUseSymbolsForNames {
+	// setup & execute
+	GBClassData *class = [GBClassData classDataWithName:[NSMutableString stringWithString:@"Class"]];
+	GBCategoryData *category = [GBCategoryData categoryDataWithName:@"Category" className:[NSMutableString stringWithString:@"Class"]];
+	GBProtocolData *protocol = [GBProtocolData protocolDataWithName:[NSMutableString stringWithString:@"Protocol"]];
+	// verify
+	assertThatBool(class.nameOfClass == category.nameOfClass, equalToBool(YES));
+	assertThatBool(category.idOfCategory == [GBSymbol symbolWithString:@"Class(Category)"], equalToBool(YES));
+	assertThatBool(protocol.nameOfProtocol == [GBSymbol symbolWithString:@"Protocol"], equalToBool(YES));
+}
+
+@end
@@ -7,6 +7,8 @@
 //
 
 #import "GRMustache.h"
+#import "GBDataObjects.h"
+#import "GBHTMLTemplateVariablesProvider.h"
 #import "GBTemplateHandler.h"
 
 @interface GBTemplateHandler (TestingAPI)
@@ -24,6 +26,7 @@
 #pragma mark -
 
 @interface GBTemplateHandlerTesting : GHTestCase
+- (NSString *)objectTemplatePath;
 @end
 
 @implementation GBTemplateHandlerTesting
@@ -173,6 +176,58 @@
 	assertThat([loader.templateSections objectForKey:@"name2"], is(@"text2\n\tline2"));
 }
 
+#pragma mark Compiled templates
+
+- (void)testHandlerWithTemplateFile_shouldReuseHandlerIfFileIsUnchanged {
+	// setup
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"GBTemplateHandlerTesting-template.html"];
+	[@"text Section name value EndSection" writeToFile:path atomically:YES encoding:NSUTF8StringEncoding error:nil];
+	// execute
+	GBTemplateHandler *handler1 = [GBTemplateHandler handlerWithTemplateFile:path error:nil];
+	GBTemplateHandler *handler2 = [GBTemplateHandler handlerWithTemplateFile:path error:nil];
+	// verify
+	assertThat(handler1, isNot(nil));
+	assertThat(handler1.templateString, is(@"text"));
+	assertThat([handler1.templateSections objectForKey:@"name"], is(@"value"));
+	assertThatBool(handler1 == handler2, equalToBool(YES));
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+- (void)testHandlerWithTemplateFile_shouldParseTemplateAgainIfFileIsModified {
+	// setup
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"GBTemplateHandlerTesting-template.html"];
+	[@"text1" writeToFile:path atomically:YES encoding:NSUTF8StringEncoding error:nil];
+	GBTemplateHandler *handler1 = [GBTemplateHandler handlerWithTemplateFile:path error:nil];
+	[@"text2" writeToFile:path atomically:YES encoding:NSUTF8StringEncoding error:nil];
+	NSDictionary *attributes = [NSDictionary dictionaryWithObject:[NSDate dateWithTimeIntervalSinceNow:60] forKey:NSFileModificationDate];
+	[[NSFileManager defaultManager] setAttributes:attributes ofItemAtPath:path error:nil];
+	// execute
+	GBTemplateHandler *handler2 = [GBTemplateHandler handlerWithTemplateFile:path error:nil];
+	// verify
+	assertThatBool(handler1 == handler2, equalToBool(NO));
+	assertThat(handler1.templateString, is(@"text1"));
+	assertThat(handler2.templateString, is(@"text2"));
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+- (void)testHandlerWithTemplateFile_shouldParseTemplateAgainIfContentsChangeWithSameDate {
+	// setup
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"GBTemplateHandlerTesting-template.html"];
+	NSDictionary *attributes = [NSDictionary dictionaryWithObject:[NSDate dateWithTimeIntervalSinceReferenceDate:0] forKey:NSFileModificationDate];
+	[@"text1" writeToFile:path atomically:YES encoding:NSUTF8StringEncoding error:nil];
+	[[NSFileManager defaultManager] setAttributes:attributes ofItemAtPath:path error:nil];
+	GBTemplateHandler *handler1 = [GBTemplateHandler handlerWithTemplateFile:path error:nil];
+	[@"text2" writeToFile:path atomically:YES encoding:NSUTF8StringEncoding error:nil];
+	[[NSFileManager defaultManager] setAttributes:attributes ofItemAtPath:path error:nil];
+	// execute
+	GBTemplateHandler *handler2 = [GBTemplateHandler handlerWithTemplateFile:path error:nil];
+	// verify
+	assertThatBool(handler1 == handler2, equalToBool(NO));
+	assertThat(handler1.templateString, is(@"text1"));
+	assertThat(handler2.templateString, is(@"text2"));
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
 #pragma mark Template handling
 
 - (void)testParsetTemplate_template_shouldCreateTemplateInstance {
@@ -248,4 +303,48 @@
 	assertThat(result, is(@"prefix value1! value2?"));
 }
 
+- (void)testRenderObjectToFile_shouldWriteSameOutputAsRenderObject {
+	// setup
+	NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"GBTemplateHandlerTesting.html"];
+	GBTemplateHandler *loader = [GBTemplateHandler handler];
+	[loader parseTemplate:@"prefix {{#items}}{{>name}}{{/items}} suffix Section name [{{value}}] EndSection" error:nil];
+	NSMutableArray *items = [NSMutableArray array];
+	for (NSUInteger i=0; i<10000; i++) [items addObject:[NSDictionary dictionaryWithObject:[NSString stringWithFormat:@"value%lu \u010D\u0161\u017E", i] forKey:@"value"]];
+	NSDictionary *vars = [NSDictionary dictionaryWithObject:items forKey:@"items"];
+	// execute
+	BOOL result = [loader renderObject:vars toFile:path error:nil];
+	// verify
+	assertThatBool(result, equalToBool(YES));
+	assertThat([NSString stringWithContentsOfFile:path encoding:NSUTF8StringEncoding error:nil], is([loader renderObject:vars]));
+	[[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+- (void)testRenderObject_shouldRenderObjectTemplateForLargeClass {
+	// setup
+	GBTemplateHandler *loader = [GBTemplateHandler handler];
+	[loader parseTemplateFromPath:[self objectTemplatePath] error:nil];
+	GBClassData *class = [GBClassData classDataWithName:@"Class"];
+	[class.methods registerSectionWithName:@"Section"];
+	for (NSUInteger i=0; i<2000; i++) {
+		NSString *name = [NSString stringWithFormat:@"method%lu", i];
+		[class.methods registerMethod:[GBTestObjectsRegistry instanceMethodWithNames:name, nil]];
+	}
+	GBHTMLTemplateVariablesProvider *provider = [GBHTMLTemplateVariablesProvider providerWithSettingsProvider:[GBTestObjectsRegistry realSettingsProvider]];
+	NSDictionary *vars = [provider variablesForClass:class withStore:[GBTestObjectsRegistry store]];
+	// execute
+	NSDate *start = [NSDate date];
+	NSString *result = [loader renderObject:vars];
+	NSTimeInterval time = -[start timeIntervalSinceNow];
+	// verify
+	GHTestLog(@"Rendering object template for class with 2000 methods took %.4fs.", time);
+	assertThatBool([result rangeOfString:@"method1999"].location != NSNotFound, equalToBool(YES));
+}
+
+#pragma mark Creation methods
+
+- (NSString *)objectTemplatePath {
+	NSString *root = [[[NSString stringWithUTF8String:__FILE__] stringByDeletingLastPathComponent] stringByDeletingLastPathComponent];
+	return [root stringByAppendingPathComponent:@"Templates/html/object-template.html"];
+}
+
 @end
@@ -29,6 +29,7 @@
 	[[[result stub] andReturn:@"company"] projectCompany];
 	[[[result stub] andReturn:[GBCommentComponentsProvider provider]] commentComponents];
 	[[[result stub] andReturn:[GBApplicationStringsProvider provider]] stringTemplates];
+	[[[result stub] andReturnValue:[NSNumber numberWithUnsignedInteger:1]] numberOfThreads];
 	return result;
 }
 
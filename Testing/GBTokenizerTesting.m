@@ -6,6 +6,7 @@
 //  Copyright (C) 2010 Gentle Bytes. All rights reserved.
 //
 
+#import "GBLexer.h"
 #import "GBTokenizer.h"
 
 @interface GBTokenizerTesting : GHTestCase
@@ -14,6 +15,8 @@
 - (PKTokenizer *)longTokenizer;
 - (PKTokenizer *)commentsTokenizer;
 - (PKTokenizer *)succesiveCommentsTokenizer;
+- (PKTokenizer *)largeTokenizerWithCommentLines:(NSUInteger)lines;
+- (PKTokenizer *)parserTokenizerWithString:(NSString *)string;
 
 @end
 
@@ -263,6 +266,74 @@
 	assertThat([[tokenizer currentToken] stringValue], is(@"one"));
 }
 
+- (void)testConsumeBlockBodyTo_shouldStopAtClosingBrace {
+	// setup
+	GBTokenizer *tokenizer1 = [GBTokenizer tokenizerWithSource:[PKTokenizer tokenizerWithString:@"one { two } three } four"] filename:@"file"];
+	GBTokenizer *tokenizer2 = [GBTokenizer tokenizerWithLexer:[GBLexer lexerWithString:@"one { two } three } four"] filename:@"file"];
+	// execute
+	[tokenizer1 consumeBlockBodyTo:@"@end"];
+	[tokenizer2 consumeBlockBodyTo:@"@end"];
+	// verify
+	assertThat([[tokenizer1 currentToken] stringValue], is(@"}"));
+	assertThat([[tokenizer1 lookahead:1] stringValue], is(@"four"));
+	assertThat([[tokenizer2 currentToken] stringValue], is(@"}"));
+	assertThat([[tokenizer2 lookahead:1] stringValue], is(@"four"));
+}
+
+- (void)testConsumeBlockBodyTo_shouldConsumeEndToken {
+	// setup
+	GBTokenizer *tokenizer1 = [GBTokenizer tokenizerWithSource:[PKTokenizer tokenizerWithString:@"one { two @end three"] filename:@"file"];
+	GBTokenizer *tokenizer2 = [GBTokenizer tokenizerWithLexer:[GBLexer lexerWithString:@"one { two @end three"] filename:@"file"];
+	// execute
+	[tokenizer1 consumeBlockBodyTo:@"@end"];
+	[tokenizer2 consumeBlockBodyTo:@"@end"];
+	// verify
+	assertThat([[tokenizer1 currentToken] stringValue], is(@"three"));
+	assertThat([[tokenizer2 currentToken] stringValue], is(@"three"));
+}
+
+- (void)testConsumeBlockBodyTo_shouldHandleCommentsAsConsume {
+	// setup
+	NSString *input = @"one /** first */ two\n/// second\nthree } /** fourth */ four";
+	GBTokenizer *tokenizer1 = [GBTokenizer tokenizerWithLexer:[GBLexer lexerWithString:input] filename:@"file"];
+	GBTokenizer *tokenizer2 = [GBTokenizer tokenizerWithLexer:[GBLexer lexerWithString:input] filename:@"file"];
+	// execute
+	[tokenizer1 consume:3];
+	[tokenizer2 consumeBlockBodyTo:@"@end"];
+	// verify
+	assertThat([[tokenizer2 currentToken] stringValue], is(@"}"));
+	assertThat([tokenizer2.lastComment stringValue], is([tokenizer1.lastComment stringValue]));
+	assertThat([tokenizer2.previousComment stringValue], is([tokenizer1.previousComment stringValue]));
+	assertThatInteger(tokenizer2.lastComment.sourceInfo.lineNumber, equalToInteger(tokenizer1.lastComment.sourceInfo.lineNumber));
+	assertThat([tokenizer2.lastComment stringValue], is(@"second"));
+	assertThat([tokenizer2.previousComment stringValue], is(@"first"));
+}
+
+- (void)testConsumeBlockBodyTo_shouldHandleBlockWithoutTrailingCommentAsConsume {
+	// setup
+	NSString *input = @"one /** first */ two
+three
+}
+/** fourth */
+four";
+	GBTokenizer *tokenizer1 = [GBTokenizer tokenizerWithLexer:[GBLexer lexerWithString:input] filename:@"file"];
+	GBTokenizer *tokenizer2 = [GBTokenizer tokenizerWithLexer:[GBLexer lexerWithString:input] filename:@"file"];
+	// execute
+	[tokenizer1 consume:3];
+	[tokenizer2 consumeBlockBodyTo:@"@end"];
+	GBSourceInfo *info1 = tokenizer1.lastComment.sourceInfo;
+	GBSourceInfo *info2 = tokenizer2.lastComment.sourceInfo;
+	[tokenizer1 consume:1];
+	[tokenizer2 consume:1];
+	// verify
+	assertThat(info2, is(info1));
+	assertThat([[tokenizer2 currentToken] stringValue], is(@"four"));
+	assertThat([tokenizer2.lastComment stringValue], is(@"fourth"));
+	assertThat([tokenizer2.previousComment stringValue], is([tokenizer1.previousComment stringValue]));
+	assertThatInteger(tokenizer2.lastComment.sourceInfo.lineNumber, equalToInteger(4));
+	assertThatInteger(tokenizer2.previousComment.sourceInfo.lineNumber, equalToInteger(tokenizer1.previousComment.sourceInfo.lineNumber));
+}
+
 #pragma mark Comments parsing testing
 
 - (void)testLastCommentString_shouldTrimSpacesFromBothEnds {
@@ -310,6 +381,17 @@
 	assertThat([tokenizer3.lastComment stringValue], is(@"\nfirst\nsecond\n"));
 }
 
+- (void)testLastCommentString_shouldRemoveDelimiterLines {
+	// setup & execute
+	GBTokenizer *tokenizer1 = [GBTokenizer tokenizerWithSource:[PKTokenizer tokenizerWithString:@"/// -----\n/// line1\n/// -----\n ONE"] filename:@"file"];
+	GBTokenizer *tokenizer2 = [GBTokenizer tokenizerWithSource:[PKTokenizer tokenizerWithString:@"/// ***** Title\n/// line\n ONE"] filename:@"file"];
+	GBTokenizer *tokenizer3 = [GBTokenizer tokenizerWithSource:[PKTokenizer tokenizerWithString:@"/**\n *==========\n * first\n */ ONE"] filename:@"file"];
+	// verify
+	assertThat([tokenizer1.lastComment stringValue], is(@"line1"));
+	assertThat([tokenizer2.lastComment stringValue], is(@"Title\nline"));
+	assertThat([tokenizer3.lastComment stringValue], is(@"\nfirst\n"));
+}
+
 - (void)testLastCommentString_shouldKeepExampleTabs {
 	// setup & execute
 	GBTokenizer *tokenizer = [GBTokenizer tokenizerWithSource:[PKTokenizer tokenizerWithString:@"/** line1\n\n\texample1\n\texample2\n\nline2 */\n   ONE"] filename:@"file"];
@@ -349,8 +431,124 @@
 	assertThatInteger([tokenizer.lastComment.sourceInfo lineNumber], equalToInteger(3));
 }
 
+#pragma mark Lexer testing
+
+- (void)testInitWithLexer_shouldReportSameTokensAsParseKit {
+	// setup
+	NSString *input = @"#import <Foundation/Foundation.h>\n/// Comment\n/// line2\n@interface _MyClass : NSObject <P1, P2> { int _var; } // ordinary\n/** Method */\n- (id)method:(NSString *)value, ... NS_REQUIRES_NIL_TERMINATION;\n/* ordinary */ @property (readonly) CGFloat x; // -1 2.5 .5 -.5\n#define A(x) (x <= -1 && x != 2.5 || x >= .5 || x == 'c')\nNSString *s = @\"string\"; x = y-1;\n@end";
+	GBTokenizer *expected = [GBTokenizer tokenizerWithSource:[self parserTokenizerWithString:input] filename:@"file"];
+	GBTokenizer *actual = [GBTokenizer tokenizerWithLexer:[GBLexer lexerWithString:input] filename:@"file"];
+	// execute & verify
+	while (![expected eof]) {
+		assertThatBool([actual eof], equalToBool(NO));
+		assertThat([actual.currentToken stringValue], is([expected.currentToken stringValue]));
+		assertThatInteger([actual.currentToken tokenType], equalToInteger([expected.currentToken tokenType]));
+		assertThatInteger([[actual sourceInfoForCurrentToken] lineNumber], equalToInteger([[expected sourceInfoForCurrentToken] lineNumber]));
+		assertThat([actual.lastComment stringValue], is([expected.lastComment stringValue]));
+		[expected consume:1];
+		[actual consume:1];
+	}
+	assertThatBool([actual eof], equalToBool(YES));
+}
+
+- (void)testInitWithLexer_shouldHandleMultibyteCharacters {
+	// setup & execute
+	GBTokenizer *tokenizer = [GBTokenizer tokenizerWithLexer:[GBLexer lexerWithString:@"/// \u010Dr\u0161\n/// \u017Eabc\nONE \u010CTWO\nTHREE"] filename:@"file"];
+	// verify
+	assertThat([tokenizer.lastComment stringValue], is(@"\u010Dr\u0161\n\u017Eabc"));
+	assertThatInteger(tokenizer.lastComment.sourceInfo.lineNumber, equalToInteger(1));
+	assertThat([[tokenizer lookahead:1] stringValue], is(@"\u010CTWO"));
+	[tokenizer consume:2];
+	assertThat([tokenizer.currentToken stringValue], is(@"THREE"));
+	assertThatInteger([[tokenizer sourceInfoForCurrentToken] lineNumber], equalToInteger(4));
+}
+
+- (void)testInitWithLexer_shouldIgnoreByteOrderMark {
+	// setup
+	const unsigned char bytes[] = { 0xEF, 0xBB, 0xBF, 'O', 'N', 'E' };
+	// execute
+	GBLexer *lexer = [GBLexer lexerWithData:[NSData dataWithBytes:bytes length:sizeof(bytes)]];
+	// verify
+	assertThatInteger(lexer.numberOfTokens, equalToInteger(1));
+	assertThat([[lexer tokenAtIndex:0] stringValue], is(@"ONE"));
+}
+
+- (void)testIsValidUTF8Data_shouldDetectInvalidSequences {
+	// setup
+	const unsigned char valid[] = { 'a', 0xC4, 0x8D, 0xE2, 0x82, 0xAC, 0xF0, 0x9F, 0x98, 0x80 };
+	const unsigned char truncated[] = { 'a', 0xC4 };
+	const unsigned char overlong[] = { 0xC0, 0xAF };
+	const unsigned char surrogate[] = { 0xED, 0xA0, 0x80 };
+	const unsigned char latin1[] = { 'a', 0xE8, 'b' };
+	// execute & verify
+	assertThatBool([GBLexer isValidUTF8Data:[NSData dataWithBytes:valid length:sizeof(valid)]], equalToBool(YES));
+	assertThatBool([GBLexer isValidUTF8Data:[NSData dataWithBytes:truncated length:sizeof(truncated)]], equalToBool(NO));
+	assertThatBool([GBLexer isValidUTF8Data:[NSData dataWithBytes:overlong length:sizeof(overlong)]], equalToBool(NO));
+	assertThatBool([GBLexer isValidUTF8Data:[NSData dataWithBytes:surrogate length:sizeof(surrogate)]], equalToBool(NO));
+	assertThatBool([GBLexer isValidUTF8Data:[NSData dataWithBytes:latin1 length:sizeof(latin1)]], equalToBool(NO));
+}
+
+- (void)testTokenAtIndex_shouldReturnSameInstanceForSameIndex {
+	// setup
+	GBLexer *lexer = [GBLexer lexerWithString:@"one two"];
+	// execute
+	PKToken *token1 = [lexer tokenAtIndex:1];
+	PKToken *token2 = [lexer tokenAtIndex:1];
+	// verify
+	assertThatInteger(lexer.numberOfTokens, equalToInteger(2));
+	assertThat(token1, sameInstance(token2));
+	assertThat([token1 stringValue], is(@"two"));
+}
+
+#pragma mark Lookahead with comments testing
+
+- (void)testLookahead_shouldSkipCommentTokens {
+	// setup - both inputs contain the same language tokens, but the second one also contains a block of single line comments before each declaration.
+	GBTokenizer *plain = [GBTokenizer tokenizerWithSource:[self largeTokenizerWithCommentLines:0] filename:@"file"];
+	GBTokenizer *commented = [GBTokenizer tokenizerWithSource:[self largeTokenizerWithCommentLines:20] filename:@"file"];
+	// execute & verify
+	NSUInteger index = 0;
+	while ([plain lookahead:index] != [PKToken EOFToken]) {
+		assertThat([[commented lookahead:index] stringValue], is([[plain lookahead:index] stringValue]));
+		index++;
+	}
+	assertThat([commented lookahead:index], sameInstance([PKToken EOFToken]));
+	assertThatBool(index > 5000, equalToBool(YES));
+}
+
+#pragma mark Performance testing
+
+- (void)testLookaheadAndConsume_shouldLogTimesForLargeCommentedHeader {
+	// setup
+	GBTokenizer *tokenizer1 = [GBTokenizer tokenizerWithSource:[self largeTokenizerWithCommentLines:20] filename:@"file"];
+	GBTokenizer *tokenizer2 = [GBTokenizer tokenizerWithSource:[self largeTokenizerWithCommentLines:20] filename:@"file"];
+	// execute
+	NSDate *start = [NSDate date];
+	NSUInteger count = 0;
+	while ([tokenizer1 lookahead:count] != [PKToken EOFToken]) count++;
+	NSTimeInterval lookaheadTime = -[start timeIntervalSinceNow];
+	start = [NSDate date];
+	while (![tokenizer2 eof]) [tokenizer2 consume:1];
+	NSTimeInterval consumeTime = -[start timeIntervalSinceNow];
+	// verify - times depend on the machine, so they are only logged.
+	GHTestLog(@"Lookahead through %lu tokens took %.4fs, consuming them took %.4fs.", count, lookaheadTime, consumeTime);
+}
+
 #pragma mark Miscellaneous methods
 
+- (void)testSourceInfoForCurrentToken_shouldReturnProperLineNumber {
+	// setup
+	GBTokenizer *tokenizer = [GBTokenizer tokenizerWithSource:[PKTokenizer tokenizerWithString:@"ONE\nTWO\n\nTHREE\nFOUR"] filename:@"file"];
+	// execute & verify
+	assertThatInteger([[tokenizer sourceInfoForCurrentToken] lineNumber], equalToInteger(1));
+	[tokenizer consume:1];
+	assertThatInteger([[tokenizer sourceInfoForCurrentToken] lineNumber], equalToInteger(2));
+	[tokenizer consume:1];
+	assertThatInteger([[tokenizer sourceInfoForCurrentToken] lineNumber], equalToInteger(4));
+	[tokenizer consume:1];
+	assertThatInteger([[tokenizer sourceInfoForCurrentToken] lineNumber], equalToInteger(5));
+}
+
 - (void)testResetComments_shouldResetCommentValues {
 	// setup - remember that initializer already moves to first non-comment token!
 	GBTokenizer *tokenizer = [GBTokenizer tokenizerWithSource:[PKTokenizer tokenizerWithString:@"/** comment1 */ /** comment2 */ ONE"] filename:@"file"];
@@ -379,4 +577,22 @@
 	return [PKTokenizer tokenizerWithString:@"ONE\n/// first\n/// first1\n\n/// second\nTWO\n/// third\nTHREE FOUR"];
 }
 
+- (PKTokenizer *)largeTokenizerWithCommentLines:(NSUInteger)lines {
+	NSMutableString *input = [NSMutableString stringWithString:@"@interface MyClass : NSObject\n"];
+	for (NSUInteger i=0; i<500; i++) {
+		for (NSUInteger j=0; j<lines; j++) [input appendFormat:@"/// Comment line %lu\n", j];
+		[input appendFormat:@"- (void)method%lu:(id)value;\n", i];
+	}
+	[input appendString:@"@end\n"];
+	return [PKTokenizer tokenizerWithString:input];
+}
+
+- (PKTokenizer *)parserTokenizerWithString:(NSString *)string {
+	// Same setup as GBObjectiveCParser uses.
+	PKTokenizer *result = [PKTokenizer tokenizerWithString:string];
+	[result setTokenizerState:result.wordState from:'_' to:'_'];
+	[result.symbolState add:@"..."];
+	return result;
+}
+
 @end